@@ -0,0 +1,64 @@
+#include "AIScheduler.h"
+#include <algorithm>
+
+AIScheduler::AIScheduler(unsigned bucketCount, unsigned farThinkFactor, unsigned thinkBudget)
+    : buckets(std::max(1u, bucketCount)), farFactor(std::max(1u, farThinkFactor)),
+    budget(std::max(1u, thinkBudget)), tick(0), start(0) {
+}
+
+void AIScheduler::update(std::vector<std::unique_ptr<EnemyTank>>& enemies, const sf::FloatRect& focusArea) {
+    tick++;
+
+    size_t count = enemies.size();
+    if (count == 0) return;
+
+    // Enemies the budget cut off earlier go first, then those due by bucket.
+    // Both passes start where the previous tick ran out of budget, so when
+    // more enemies are due than the budget allows they are served round-robin
+    // and none waits more than count / budget ticks past its turn.
+    size_t first = start % count;
+    unsigned thinks = 0;
+    for (int pass = 0; pass < 2; ++pass) {
+        for (size_t n = 0; n < count; ++n) {
+            size_t index = (first + n) % count;
+            EnemyTank& enemy = *enemies[index];
+            if (enemy.isDestroyed()) continue;
+
+            bool overdue = enemy.isThinkOverdue() || enemy.needsFirstThink();
+            if (overdue != (pass == 0)) continue;
+
+            AITier tier = focusArea.contains(enemy.getCenter()) ? AITier::FULL : AITier::REDUCED;
+            if (!overdue) {
+                unsigned long interval = tier == AITier::FULL ? buckets : buckets * farFactor;
+                if ((tick + index) % interval != 0) continue;
+            }
+
+            if (thinks >= budget) {
+                enemy.markThinkOverdue();
+                stats.deferred++;
+                continue;
+            }
+
+            enemy.think(tier);
+            thinks++;
+            if (tier == AITier::FULL) stats.fullThinks++;
+            else stats.reducedThinks++;
+
+            if (thinks == budget) {
+                start = index + 1;
+            }
+        }
+    }
+}
+
+void AIScheduler::saveState(SnapshotWriter& out) const {
+    out.write(tick);
+    out.write(start);
+    out.write(stats);
+}
+
+void AIScheduler::loadState(SnapshotReader& in) {
+    in.read(tick);
+    in.read(start);
+    in.read(stats);
+}
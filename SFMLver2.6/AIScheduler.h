@@ -0,0 +1,43 @@
+#pragma once
+#include "Constants.h"
+#include "EnemyTank.h"
+#include "Snapshot.h"
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <memory>
+
+// Spreads EnemyTank::think() calls across ticks. Enemies are split into
+// round-robin buckets by index and one bucket thinks per tick; enemies
+// outside the focus area drop to AITier::REDUCED and think several rounds
+// apart. No more than the budget think in one tick, so AI cost per tick stays
+// flat as enemy count grows; enemies the budget cuts off think first on the
+// following ticks. Movement still integrates every tick.
+class AIScheduler {
+public:
+    struct Stats {
+        unsigned long fullThinks = 0;
+        unsigned long reducedThinks = 0;
+        unsigned long deferred = 0;
+    };
+
+private:
+    unsigned buckets;
+    unsigned farFactor;
+    unsigned budget;
+    unsigned long tick;
+    size_t start;
+    Stats stats;
+
+public:
+    AIScheduler(unsigned bucketCount = Constants::AI_THINK_BUCKETS,
+        unsigned farThinkFactor = Constants::AI_FAR_THINK_FACTOR,
+        unsigned thinkBudget = Constants::AI_THINK_BUDGET);
+
+    // focusArea is the part of the world the player can see
+    void update(std::vector<std::unique_ptr<EnemyTank>>& enemies, const sf::FloatRect& focusArea);
+
+    const Stats& getStats() const { return stats; }
+
+    void saveState(SnapshotWriter& out) const;
+    void loadState(SnapshotReader& in);
+};
@@ -0,0 +1,8 @@
+#pragma once
+#include <cstddef>
+
+// Counts every call to the global operator new. Used to check that the
+// simulation does not touch the heap once combat reaches a steady state.
+namespace AllocationCounter {
+    std::size_t getCount();
+}
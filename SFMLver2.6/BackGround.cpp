@@ -1,17 +1,22 @@
 #include "Background.h"
+#include "ResourceManager.h"
 #include <iostream>
-Background::Background() : parallaxFactor(0.1f) {
+#include <cmath>
+Background::Background() : backgroundTexture(nullptr), parallaxFactor(0.1f) {
     tileSize = sf::Vector2u(100, 100); // Default tile size
     windowSize = sf::Vector2u(800, 600); // Default window size
 }
 
 bool Background::loadBackground(const std::string& texturePath) {
-    if (!backgroundTexture.loadFromFile(texturePath)) {
+    ResourceManager::TextureRegion region = ResourceManager::instance().getTextureRegion(texturePath);
+    backgroundTexture = region.texture;
+    backgroundRect = region.rect;
+    if (!backgroundTexture) {
         std::cout << "Failed to load background texture: " << texturePath << std::endl;
         return false;
     }
 
-    tileSize = backgroundTexture.getSize();
+    tileSize = sf::Vector2u(static_cast<unsigned>(backgroundRect.width), static_cast<unsigned>(backgroundRect.height));
     std::cout << "Background texture loaded: " << tileSize.x << "x" << tileSize.y << std::endl;
 
     // Create tiled background
@@ -22,7 +27,8 @@ bool Background::loadBackground(const std::string& texturePath) {
     for (unsigned int y = 0; y < tilesY; ++y) {
         for (unsigned int x = 0; x < tilesX; ++x) {
             sf::Sprite tile;
-            tile.setTexture(backgroundTexture);
+            tile.setTexture(*backgroundTexture);
+            tile.setTextureRect(backgroundRect);
             tile.setPosition(
                 static_cast<float>(x * tileSize.x),
                 static_cast<float>(y * tileSize.y)
@@ -43,15 +49,22 @@ void Background::update(float deltaTime) {
     // This can be enhanced with camera movement
 }
 
-void Background::draw(sf::RenderWindow& window) {
+void Background::draw(SpriteBatch& batch, const sf::FloatRect& visibleArea) {
+    if (tileSize.x == 0 || tileSize.y == 0) return;
+
+    sf::Transform offset;
+    offset.translate(std::floor(visibleArea.left / tileSize.x) * tileSize.x,
+        std::floor(visibleArea.top / tileSize.y) * tileSize.y);
+
     // Draw all tiled 
     for (const auto& sprite : tiledSprites) {
-        window.draw(sprite);
+        batch.draw(sprite, LAYER_BACKGROUND, offset);
     }
 }
 
 void Background::resize(sf::Vector2u newSize) {
     windowSize = newSize;
+    if (!backgroundTexture) return;
 
     // Recalculate tiles needed
     unsigned int tilesX = (windowSize.x / tileSize.x) + 2;
@@ -61,7 +74,8 @@ void Background::resize(sf::Vector2u newSize) {
     for (unsigned int y = 0; y < tilesY; ++y) {
         for (unsigned int x = 0; x < tilesX; ++x) {
             sf::Sprite tile;
-            tile.setTexture(backgroundTexture);
+            tile.setTexture(*backgroundTexture);
+            tile.setTextureRect(backgroundRect);
             tile.setPosition(
                 static_cast<float>(x * tileSize.x),
                 static_cast<float>(y * tileSize.y)
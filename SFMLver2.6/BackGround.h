@@ -1,10 +1,12 @@
 #pragma once
+#include "SpriteBatch.h"
 #include <SFML/Graphics.hpp>
 #include <vector>
 
 class Background {
 private:
-    sf::Texture backgroundTexture;
+    const sf::Texture* backgroundTexture;
+    sf::IntRect backgroundRect;
     sf::Sprite backgroundSprite;
 
     // Tiled background
@@ -20,6 +22,7 @@ public:
     bool loadBackground(const std::string& texturePath);
     void setParallaxFactor(float factor);
     void update(float deltaTime);
-    void draw(sf::RenderWindow& window);
+    // Tiles cover visibleArea, snapped to the tile grid so they scroll with the world
+    void draw(SpriteBatch& batch, const sf::FloatRect& visibleArea);
     void resize(sf::Vector2u newSize);
 };
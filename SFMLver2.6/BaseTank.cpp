@@ -3,9 +3,10 @@
 #include <algorithm>
 
 BaseTank::BaseTank(sf::Vector2f pos, float spd, sf::Color color,
-    std::vector<std::unique_ptr<Bullet>>* bullets)
-    : GameObject(pos, Constants::PLAYER_HEALTH), speed(spd), rotation(0.0f),
-    maxAttackCooldown(Constants::PLAYER_ATTACK_COOLDOWN), bulletContainer(bullets) {
+    BulletPool* bullets)
+    : GameObject(pos, Constants::PLAYER_HEALTH), speed(spd), rotation(0.0f), attackTimer(0.0f),
+    maxAttackCooldown(Constants::PLAYER_ATTACK_COOLDOWN), bulletContainer(bullets),
+    tuning(&Tuning::defaults()) {
 
     body.setSize(sf::Vector2f(35.0f, 35.0f));
     body.setFillColor(color);
@@ -17,31 +18,27 @@ BaseTank::BaseTank(sf::Vector2f pos, float spd, sf::Color color,
 void BaseTank::update(float deltaTime) {
     if (!destroyed) {
         position = body.getPosition();
+        attackTimer += deltaTime;
     }
 }
 
-void BaseTank::draw(sf::RenderWindow& window) {
+void BaseTank::draw(SpriteBatch& batch, float alpha) {
     if (!destroyed) {
-        window.draw(body);
-        drawHealthBar(window);
+        sf::Transform offset = getRenderOffset(alpha);
+        batch.draw(body, LAYER_TANKS, offset);
+        drawHealthBar(batch, offset);
     }
 }
 
-void BaseTank::drawHealthBar(sf::RenderWindow& window) {
+void BaseTank::drawHealthBar(SpriteBatch& batch, const sf::Transform& offset) {
     if (destroyed) return;
 
-    sf::RectangleShape healthBg;
-    healthBg.setSize(sf::Vector2f(40.0f, 6.0f));
-    healthBg.setPosition(position.x - 20, position.y - 30);
-    healthBg.setFillColor(sf::Color::Red);
-    window.draw(healthBg);
+    batch.drawRect(sf::FloatRect(position.x - 20, position.y - 30, 40.0f, 6.0f),
+        sf::Color::Red, LAYER_HEALTH_BARS, offset);
 
-    sf::RectangleShape healthBar;
     float healthRatio = health / maxHealth;
-    healthBar.setSize(sf::Vector2f(40.0f * healthRatio, 6.0f));
-    healthBar.setPosition(position.x - 20, position.y - 30);
-    healthBar.setFillColor(sf::Color::Green);
-    window.draw(healthBar);
+    batch.drawRect(sf::FloatRect(position.x - 20, position.y - 30, 40.0f * healthRatio, 6.0f),
+        sf::Color::Green, LAYER_HEALTH_BARS, offset);
 }
 
 sf::FloatRect BaseTank::getBounds() const {
@@ -62,13 +59,13 @@ sf::Vector2f BaseTank::getVelocity() const {
 }
 
 bool BaseTank::canAttack() const {
-    return attackCooldown.getElapsedTime().asSeconds() >= maxAttackCooldown;
+    return attackTimer >= maxAttackCooldown;
 }
 
 void BaseTank::attack(sf::Vector2f target) {
     if (canAttack() && !destroyed) {
         createBullet(target);
-        attackCooldown.restart();
+        attackTimer = 0.0f;
     }
 }
 
@@ -93,30 +90,57 @@ float BaseTank::getRotation() const {
     return rotation;
 }
 
-bool BaseTank::canMoveTo(sf::Vector2f newPos, const std::vector<std::unique_ptr<Block>>& blocks) {
+bool BaseTank::canMoveTo(sf::Vector2f newPos, const BlockGrid& blocks) {
     sf::FloatRect futurePos;
     futurePos.left = newPos.x - 17.5f;
     futurePos.top = newPos.y - 17.5f;
     futurePos.width = 35.0f;
     futurePos.height = 35.0f;
 
-    for (const auto& block : blocks) {
-        if (block && !block->isDestroyed() && block->isBlocking()) {
-            if (futurePos.intersects(block->getBounds())) {
-                return false;
-            }
-        }
-    }
-    return true;
+    return !blocks.isAreaBlocked(futurePos);
 }
 
-void BaseTank::updateMovement(float deltaTime, const std::vector<std::unique_ptr<Block>>& blocks) {
-    if (destroyed) return;
+void BaseTank::saveState(SnapshotWriter& out) const {
+    out.write(position);
+    out.write(previousPosition);
+    out.writeFlag(destroyed);
+    out.write(health);
+    out.write(maxHealth);
+    out.write(velocity);
+    out.write(speed);
+    out.write(rotation);
+    out.write(attackTimer);
+    out.write(maxAttackCooldown);
+}
 
-    sf::Vector2f newPos = position + velocity * deltaTime;
+void BaseTank::loadState(SnapshotReader& in) {
+    sf::Vector2f pos = in.read<sf::Vector2f>();
+    sf::Vector2f previous = in.read<sf::Vector2f>();
+    destroyed = in.readFlag();
+    in.read(health);
+    in.read(maxHealth);
+    in.read(velocity);
+    in.read(speed);
+    float angle = in.read<float>();
+    in.read(attackTimer);
+    in.read(maxAttackCooldown);
+
+    setPosition(pos);
+    previousPosition = previous;
+    setRotation(angle);
+}
+
+sf::Vector2f BaseTank::clampToArea(sf::Vector2f pos, const sf::FloatRect& area) {
+    const float margin = 20.0f;
+    pos.x = std::max(area.left + margin, std::min(area.left + area.width - margin, pos.x));
+    pos.y = std::max(area.top + margin, std::min(area.top + area.height - margin, pos.y));
+    return pos;
+}
+
+void BaseTank::updateMovement(float deltaTime, const BlockGrid& blocks, const sf::FloatRect& area) {
+    if (destroyed) return;
 
-    newPos.x = std::max(20.0f, std::min(780.0f, newPos.x));
-    newPos.y = std::max(20.0f, std::min(580.0f, newPos.y));
+    sf::Vector2f newPos = clampToArea(position + velocity * deltaTime, area);
 
     if (canMoveTo(newPos, blocks)) {
         setPosition(newPos);
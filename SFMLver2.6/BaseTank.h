@@ -2,8 +2,11 @@
 #include "GameObject.h"
 #include "IMoveable.h"
 #include "ICombat.h"
-#include "Bullet.h"
+#include "BulletPool.h"
+#include "BlockGrid.h"
 #include "Constants.h"
+#include "Snapshot.h"
+#include "Tuning.h"
 #include <SFML/Graphics.hpp>
 #include <SFML/System.hpp>
 #include <vector>
@@ -15,20 +18,22 @@ protected:
     sf::Vector2f velocity;
     float speed;
     float rotation;
-    sf::Clock attackCooldown;
+    float attackTimer;
     float maxAttackCooldown;
-    std::vector<std::unique_ptr<Bullet>>* bulletContainer;
+    BulletPool* bulletContainer;
+    // Owned by the World; never null
+    const Tuning* tuning;
 
     virtual void createBullet(sf::Vector2f target) = 0;
-    virtual bool canMoveTo(sf::Vector2f newPos, const std::vector<std::unique_ptr<class Block>>& blocks);
+    virtual bool canMoveTo(sf::Vector2f newPos, const BlockGrid& blocks);
 
 public:
     BaseTank(sf::Vector2f pos, float spd, sf::Color color,
-        std::vector<std::unique_ptr<Bullet>>* bullets);
+        BulletPool* bullets);
     virtual ~BaseTank() = default;
 
     void update(float deltaTime) override;
-    void draw(sf::RenderWindow& window) override;
+    void draw(SpriteBatch& batch, float alpha) override;
     sf::FloatRect getBounds() const override;
 
     void move(float dx, float dy) override;
@@ -41,10 +46,21 @@ public:
     float getHealth() const override;
     float getMaxHealth() const override;
 
-    virtual void drawHealthBar(sf::RenderWindow& window);
+    virtual void drawHealthBar(SpriteBatch& batch, const sf::Transform& offset);
     virtual void setRotation(float angle);
     float getRotation() const;
-    void updateMovement(float deltaTime, const std::vector<std::unique_ptr<class Block>>& blocks);
+    void updateMovement(float deltaTime, const BlockGrid& blocks, const sf::FloatRect& area);
+
+    // Keeps a tank centre far enough inside area for the hull to stay on the map
+    static sf::Vector2f clampToArea(sf::Vector2f pos, const sf::FloatRect& area);
+
+    // Snapshot of the simulation state; textures and shapes are rebuilt from it
+    virtual void saveState(SnapshotWriter& out) const;
+    virtual void loadState(SnapshotReader& in);
+
+    // Bullets and AI read the values live; speed, health and cooldown are
+    // taken from them only when the tank is created
+    void setTuning(const Tuning* values) { tuning = values ? values : &Tuning::defaults(); }
 
     void setSpeed(float s) { speed = s; }
     void setAttackCooldown(float cooldown) { maxAttackCooldown = cooldown; }
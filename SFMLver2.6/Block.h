@@ -1,46 +1,50 @@
 #pragma once
-#include "GameObject.h"
 #include "Constants.h"
 #include <SFML/Graphics.hpp>
+#include <cstdint>
 
-enum class BlockType {
+enum class BlockType : std::uint8_t {
     DESTRUCTIBLE,  // Tree blocks
     WATER,
     WALL_INDESTRUCTIBLE  // Wall blocks that cannot be destroyed
 };
 
-class Block : public GameObject {
-private:
-    sf::RectangleShape shape;
-    BlockType type;
-    sf::Color originalColor;
+const int BLOCK_TYPE_COUNT = 3;
 
-    // Texture support for different block types
-    sf::Texture treeTexture;
-    sf::Sprite treeSprite;
-    sf::Texture waterTexture;
-    sf::Sprite waterSprite;
-    sf::Texture wallTexture;
-    sf::Sprite wallSprite;
+// Everything blocks of one type share. Looked up by type so a Block itself
+// only carries its own state.
+struct BlockStyle {
+    const char* texturePath;
+    sf::Color color;
+    float health;
+    bool destructible;
+    bool blocking;
+};
 
-    // Water texture support (no animation)
+const BlockStyle& getBlockStyle(BlockType type);
+
+// Compact level tile: centre, remaining health and type. Blocks are stored by
+// value and drawn through BlockRenderer.
+class Block {
+private:
+    sf::Vector2f position;
+    float health;
+    BlockType type;
+    bool destroyed;
 
 public:
     Block(sf::Vector2f pos, BlockType blockType);
 
-    void update(float deltaTime) override;
-    void draw(sf::RenderWindow& window) override;
-    sf::FloatRect getBounds() const override;
+    sf::FloatRect getBounds() const;
+    sf::Vector2f getCenter() const { return position; }
 
-    bool checkGrass(float x, float y);
-    void takeDamage(float damage) override;
+    void takeDamage(float damage);
+    bool isDestroyed() const { return destroyed; }
     bool isBlocking() const;
-    BlockType getType() const;
-
-    // Texture loading methods
-    bool loadTreeTexture(const std::string& texturePath);
-    bool loadWaterTexture(const std::string& texturePath);
-    bool loadWallTexture(const std::string& texturePath);
+    float getHealth() const { return health; }
+    BlockType getType() const { return type; }
+    const BlockStyle& getStyle() const { return getBlockStyle(type); }
 
-
-};
\ No newline at end of file
+    // Used by snapshot restore to bring a freshly placed block back to a saved state
+    void restoreState(float savedHealth, bool wasDestroyed) { health = savedHealth; destroyed = wasDestroyed; }
+};
@@ -0,0 +1,81 @@
+#include "BlockGrid.h"
+#include "Block.h"
+#include <algorithm>
+#include <cmath>
+
+BlockGrid::BlockGrid(unsigned width, unsigned height, unsigned cell)
+    : columns(static_cast<int>((width + cell - 1) / cell)),
+    rows(static_cast<int>((height + cell - 1) / cell)),
+    cellSize(static_cast<float>(cell)) {
+    cells.resize(static_cast<size_t>(columns) * rows);
+}
+
+int BlockGrid::cellX(float x) const {
+    int cx = static_cast<int>(std::floor(x / cellSize));
+    return std::max(0, std::min(columns - 1, cx));
+}
+
+int BlockGrid::cellY(float y) const {
+    int cy = static_cast<int>(std::floor(y / cellSize));
+    return std::max(0, std::min(rows - 1, cy));
+}
+
+void BlockGrid::clear() {
+    for (auto& cell : cells) {
+        cell.clear();
+    }
+}
+
+void BlockGrid::insert(Block* block) {
+    if (!block) return;
+
+    sf::FloatRect bounds = block->getBounds();
+    int maxX = cellX(bounds.left + bounds.width);
+    int maxY = cellY(bounds.top + bounds.height);
+    for (int y = cellY(bounds.top); y <= maxY; ++y) {
+        for (int x = cellX(bounds.left); x <= maxX; ++x) {
+            cells[y * columns + x].push_back({ block, bounds });
+        }
+    }
+}
+
+void BlockGrid::remove(const Block* block) {
+    if (!block) return;
+
+    sf::FloatRect bounds = block->getBounds();
+    int maxX = cellX(bounds.left + bounds.width);
+    int maxY = cellY(bounds.top + bounds.height);
+    for (int y = cellY(bounds.top); y <= maxY; ++y) {
+        for (int x = cellX(bounds.left); x <= maxX; ++x) {
+            auto& cell = cells[y * columns + x];
+            cell.erase(
+                std::remove_if(cell.begin(), cell.end(),
+                    [block](const Entry& entry) {
+                        return entry.block == block;
+                    }),
+                cell.end()
+            );
+        }
+    }
+}
+
+void BlockGrid::rebuild(std::vector<Block>& blocks) {
+    clear();
+    for (Block& block : blocks) {
+        if (!block.isDestroyed()) {
+            insert(&block);
+        }
+    }
+}
+
+bool BlockGrid::isAreaBlocked(const sf::FloatRect& area) const {
+    bool blocked = false;
+    forEachInArea(area, [&blocked](const Block& block) {
+        if (block.isBlocking()) {
+            blocked = true;
+            return false;
+        }
+        return true;
+    });
+    return blocked;
+}
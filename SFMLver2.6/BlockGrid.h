@@ -0,0 +1,67 @@
+#pragma once
+#include "Constants.h"
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <memory>
+#include <algorithm>
+
+class Block;
+
+// Uniform grid over level blocks with cells of Constants::BLOCK_SIZE.
+// A block is registered in every cell its bounds overlap, so queries only
+// touch the blocks near the query area.
+class BlockGrid {
+private:
+    struct Entry {
+        Block* block;
+        sf::FloatRect bounds;
+    };
+
+    int columns;
+    int rows;
+    float cellSize;
+    std::vector<std::vector<Entry>> cells;
+
+    int cellX(float x) const;
+    int cellY(float y) const;
+
+public:
+    BlockGrid(unsigned width = Constants::WORLD_WIDTH, unsigned height = Constants::WORLD_HEIGHT,
+        unsigned cell = Constants::BLOCK_SIZE);
+
+    void clear();
+    void insert(Block* block);
+    void remove(const Block* block);
+    void rebuild(std::vector<Block>& blocks);
+
+    bool isAreaBlocked(const sf::FloatRect& area) const;
+
+    // Calls fn(Block&) once for every live block whose bounds intersect area.
+    // fn returns false to stop the query early.
+    template <typename Fn>
+    void forEachInArea(const sf::FloatRect& area, Fn&& fn) const;
+};
+
+template <typename Fn>
+void BlockGrid::forEachInArea(const sf::FloatRect& area, Fn&& fn) const {
+    int minX = cellX(area.left);
+    int maxX = cellX(area.left + area.width);
+    int minY = cellY(area.top);
+    int maxY = cellY(area.top + area.height);
+
+    for (int y = minY; y <= maxY; ++y) {
+        for (int x = minX; x <= maxX; ++x) {
+            for (const Entry& entry : cells[y * columns + x]) {
+                // A block spanning several cells is reported only from the first
+                // cell it shares with the query area
+                int firstX = std::max(minX, cellX(entry.bounds.left));
+                int firstY = std::max(minY, cellY(entry.bounds.top));
+                if (x != firstX || y != firstY) continue;
+
+                if (entry.bounds.intersects(area)) {
+                    if (!fn(*entry.block)) return;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,184 @@
+#include "BlockRenderer.h"
+#include "ResourceManager.h"
+#include <algorithm>
+#include <cmath>
+
+BlockRenderer::BlockRenderer() : chunkColumns(0), chunkRows(0), mergedStale(true) {
+    for (int i = 0; i < BLOCK_TYPE_COUNT; ++i) {
+        textured[i] = false;
+    }
+}
+
+void BlockRenderer::load() {
+    float size = static_cast<float>(Constants::BLOCK_SIZE);
+    for (int i = 0; i < BLOCK_TYPE_COUNT; ++i) {
+        const BlockStyle& style = getBlockStyle(static_cast<BlockType>(i));
+
+        shapes[i].setSize(sf::Vector2f(size, size));
+        shapes[i].setOrigin(size / 2.0f, size / 2.0f);
+        shapes[i].setFillColor(style.color);
+
+        ResourceManager::TextureRegion region = ResourceManager::instance().getTextureRegion(style.texturePath);
+        textured[i] = region.texture != nullptr;
+        if (textured[i]) {
+            sprites[i].setTexture(*region.texture);
+            sprites[i].setTextureRect(region.rect);
+            sprites[i].setOrigin(region.rect.width / 2.0f, region.rect.height / 2.0f);
+            sprites[i].setScale(size / region.rect.width, size / region.rect.height);
+        }
+    }
+
+    // Baked chunks hold texture coordinates from the previous atlas
+    for (Chunk& chunk : chunks) {
+        chunk.revision = 0;
+    }
+    merged.clear();
+    mergedStale = true;
+}
+
+void BlockRenderer::draw(const Block& block, SpriteBatch& batch) {
+    if (block.isDestroyed()) return;
+
+    int index = static_cast<int>(block.getType());
+    if (textured[index]) {
+        sprites[index].setPosition(block.getCenter());
+        batch.draw(sprites[index], LAYER_BLOCKS);
+        return;
+    }
+
+    // Untextured destructible blocks darken as they take damage
+    const BlockStyle& style = block.getStyle();
+    sf::Color color = style.color;
+    if (style.destructible) {
+        float healthRatio = block.getHealth() / style.health;
+        color = sf::Color(
+            static_cast<sf::Uint8>(color.r * healthRatio),
+            static_cast<sf::Uint8>(color.g * healthRatio),
+            static_cast<sf::Uint8>(color.b * healthRatio)
+        );
+    }
+    shapes[index].setFillColor(color);
+    shapes[index].setPosition(block.getCenter());
+    batch.draw(shapes[index], LAYER_BLOCKS);
+}
+
+void BlockRenderer::draw(const BlockGrid& blocks, const sf::FloatRect& visibleArea, SpriteBatch& batch) {
+    blocks.forEachInArea(visibleArea, [&](const Block& block) {
+        if (!Tilemap::isStatic(block.getType())) {
+            draw(block, batch);
+        }
+        return true;
+    });
+}
+
+void BlockRenderer::bakeChunk(const Tilemap& tilemap, int chunkX, int chunkY, Chunk& chunk) {
+    for (auto& vertices : chunk.vertices) {
+        vertices.setPrimitiveType(sf::Triangles);
+        vertices.clear();
+    }
+
+    float size = tilemap.getTileSize();
+    int firstX = chunkX * tilemap.getChunkTiles();
+    int firstY = chunkY * tilemap.getChunkTiles();
+    int lastX = std::min(tilemap.getColumns(), firstX + tilemap.getChunkTiles());
+    int lastY = std::min(tilemap.getRows(), firstY + tilemap.getChunkTiles());
+
+    for (int y = firstY; y < lastY; ++y) {
+        for (int x = firstX; x < lastX; ++x) {
+            if (!tilemap.hasTile(x, y)) continue;
+            BlockType type = tilemap.getTile(x, y);
+            if (!Tilemap::isStatic(type)) continue;
+
+            int index = static_cast<int>(type);
+            sf::Color color = sf::Color::White;
+            sf::FloatRect texCoords;
+            if (textured[index]) {
+                sf::IntRect rect = sprites[index].getTextureRect();
+                texCoords = sf::FloatRect(static_cast<float>(rect.left), static_cast<float>(rect.top),
+                    static_cast<float>(rect.width), static_cast<float>(rect.height));
+            }
+            else {
+                color = getBlockStyle(type).color;
+            }
+
+            float left = x * size;
+            float top = y * size;
+            float texRight = texCoords.left + texCoords.width;
+            float texBottom = texCoords.top + texCoords.height;
+            sf::Vertex topLeft(sf::Vector2f(left, top), color, sf::Vector2f(texCoords.left, texCoords.top));
+            sf::Vertex topRight(sf::Vector2f(left + size, top), color, sf::Vector2f(texRight, texCoords.top));
+            sf::Vertex bottomRight(sf::Vector2f(left + size, top + size), color, sf::Vector2f(texRight, texBottom));
+            sf::Vertex bottomLeft(sf::Vector2f(left, top + size), color, sf::Vector2f(texCoords.left, texBottom));
+
+            sf::VertexArray& vertices = chunk.vertices[index];
+            vertices.append(topLeft);
+            vertices.append(topRight);
+            vertices.append(bottomRight);
+            vertices.append(topLeft);
+            vertices.append(bottomRight);
+            vertices.append(bottomLeft);
+        }
+    }
+    chunk.revision = tilemap.getChunkRevision(chunkX, chunkY);
+}
+
+sf::VertexArray& BlockRenderer::getMerged(const sf::Texture* texture) {
+    for (Merged& entry : merged) {
+        if (entry.texture == texture) return entry.vertices;
+    }
+    merged.push_back({ texture, sf::VertexArray(sf::Triangles) });
+    return merged.back().vertices;
+}
+
+void BlockRenderer::drawTilemap(const Tilemap& tilemap, const sf::FloatRect& visibleArea, SpriteBatch& batch) {
+    if (chunkColumns != tilemap.getChunkColumns() || chunkRows != tilemap.getChunkRows()) {
+        chunkColumns = tilemap.getChunkColumns();
+        chunkRows = tilemap.getChunkRows();
+        chunks.assign(static_cast<size_t>(chunkColumns) * chunkRows, Chunk());
+        mergedStale = true;
+    }
+
+    float span = tilemap.getChunkTiles() * tilemap.getTileSize();
+    int minX = std::max(0, static_cast<int>(std::floor(visibleArea.left / span)));
+    int minY = std::max(0, static_cast<int>(std::floor(visibleArea.top / span)));
+    int maxX = std::min(chunkColumns - 1, static_cast<int>(std::floor((visibleArea.left + visibleArea.width) / span)));
+    int maxY = std::min(chunkRows - 1, static_cast<int>(std::floor((visibleArea.top + visibleArea.height) / span)));
+
+    sf::IntRect range(minX, minY, maxX - minX + 1, maxY - minY + 1);
+    bool stale = mergedStale || range != mergedRange;
+    for (int y = minY; y <= maxY; ++y) {
+        for (int x = minX; x <= maxX; ++x) {
+            Chunk& chunk = chunks[y * chunkColumns + x];
+            if (chunk.revision != tilemap.getChunkRevision(x, y)) {
+                bakeChunk(tilemap, x, y, chunk);
+                stale = true;
+            }
+        }
+    }
+
+    if (stale) {
+        for (Merged& entry : merged) {
+            entry.vertices.clear();
+        }
+        for (int y = minY; y <= maxY; ++y) {
+            for (int x = minX; x <= maxX; ++x) {
+                const Chunk& chunk = chunks[y * chunkColumns + x];
+                for (int i = 0; i < BLOCK_TYPE_COUNT; ++i) {
+                    const sf::VertexArray& source = chunk.vertices[i];
+                    if (source.getVertexCount() == 0) continue;
+
+                    sf::VertexArray& target = getMerged(textured[i] ? sprites[i].getTexture() : nullptr);
+                    for (size_t v = 0; v < source.getVertexCount(); ++v) {
+                        target.append(source[v]);
+                    }
+                }
+            }
+        }
+        mergedRange = range;
+        mergedStale = false;
+    }
+
+    for (const Merged& entry : merged) {
+        batch.drawStatic(entry.vertices, entry.texture, LAYER_BLOCKS);
+    }
+}
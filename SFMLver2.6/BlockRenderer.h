@@ -0,0 +1,56 @@
+#pragma once
+#include "Block.h"
+#include "SpriteBatch.h"
+#include "Tilemap.h"
+#include "BlockGrid.h"
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+// Shared render descriptor per BlockType: one sprite (or a flat coloured
+// square when the texture is missing) configured once and stamped at every
+// block position. Static tiles are instead baked per tilemap chunk into
+// cached vertex arrays that are rebuilt only when the chunk's revision changes.
+// The visible chunks are merged into one array per texture, so the tilemap
+// costs one draw call per texture however many chunks are on screen.
+class BlockRenderer {
+private:
+    struct Chunk {
+        unsigned revision = 0;
+        sf::VertexArray vertices[BLOCK_TYPE_COUNT];
+    };
+
+    struct Merged {
+        const sf::Texture* texture;
+        sf::VertexArray vertices;
+    };
+
+    sf::Sprite sprites[BLOCK_TYPE_COUNT];
+    sf::RectangleShape shapes[BLOCK_TYPE_COUNT];
+    bool textured[BLOCK_TYPE_COUNT];
+
+    std::vector<Chunk> chunks;
+    int chunkColumns;
+    int chunkRows;
+
+    // Rebuilt only when the visible chunk range moves or a chunk in it rebakes
+    std::vector<Merged> merged;
+    sf::IntRect mergedRange;
+    bool mergedStale;
+
+    void bakeChunk(const Tilemap& tilemap, int chunkX, int chunkY, Chunk& chunk);
+    sf::VertexArray& getMerged(const sf::Texture* texture);
+
+public:
+    BlockRenderer();
+
+    // Resolves each type's texture region; call again after the atlas changes
+    void load();
+
+    void draw(const Block& block, SpriteBatch& batch);
+    // Draws the live blocks overlapping visibleArea, skipping static ones;
+    // those are drawn by drawTilemap()
+    void draw(const BlockGrid& blocks, const sf::FloatRect& visibleArea, SpriteBatch& batch);
+    // Submits the baked chunks overlapping visibleArea, rebaking stale ones,
+    // as one static array per texture
+    void drawTilemap(const Tilemap& tilemap, const sf::FloatRect& visibleArea, SpriteBatch& batch);
+};
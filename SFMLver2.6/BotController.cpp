@@ -0,0 +1,61 @@
+#include "BotController.h"
+#include "HeuristicBot.h"
+#include "World.h"
+#include <cmath>
+
+namespace {
+    // sin(22.5 degrees): a heading within 22.5 degrees of an axis presses
+    // only that axis' key
+    const float AXIS_THRESHOLD = 0.38268343f;
+}
+
+PlayerInput BotController::nextInput(const World& world) {
+    return toInput(decide(world));
+}
+
+PlayerInput BotController::toInput(const BotCommand& command) {
+    PlayerInput input;
+    float length = std::sqrt(command.move.x * command.move.x + command.move.y * command.move.y);
+    if (length > 0) {
+        sf::Vector2f heading = command.move / length;
+        if (heading.x > AXIS_THRESHOLD) input.press(PlayerInput::MOVE_RIGHT);
+        if (heading.x < -AXIS_THRESHOLD) input.press(PlayerInput::MOVE_LEFT);
+        if (heading.y > AXIS_THRESHOLD) input.press(PlayerInput::MOVE_DOWN);
+        if (heading.y < -AXIS_THRESHOLD) input.press(PlayerInput::MOVE_UP);
+    }
+
+    input.setAim(command.aim);
+    if (command.fire) {
+        input.press(PlayerInput::FIRE);
+    }
+    return input;
+}
+
+BotCommand TurretBot::decide(const World& world) {
+    BotCommand command;
+    const PlayerTank* player = world.getPlayer();
+    if (!player || player->isDestroyed()) return command;
+
+    sf::Vector2f center = player->getCenter();
+    float bestDistance = -1.0f;
+    for (const auto& enemy : world.getEnemies()) {
+        if (enemy->isDestroyed()) continue;
+
+        sf::Vector2f offset = enemy->getCenter() - center;
+        float distance = offset.x * offset.x + offset.y * offset.y;
+        if (bestDistance < 0 || distance < bestDistance) {
+            command.aim = offset;
+            bestDistance = distance;
+        }
+    }
+
+    float range = Constants::WINDOW_WIDTH / 2.0f;
+    command.fire = bestDistance >= 0 && bestDistance < range * range;
+    return command;
+}
+
+std::unique_ptr<BotController> createBot(const std::string& name) {
+    if (name == "turret") return std::make_unique<TurretBot>();
+    if (name == "heuristic") return std::make_unique<HeuristicBot>();
+    return nullptr;
+}
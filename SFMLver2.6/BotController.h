@@ -0,0 +1,37 @@
+#pragma once
+#include "PlayerInput.h"
+#include <SFML/System/Vector2.hpp>
+#include <memory>
+#include <string>
+
+// What a bot wants the player tank to do this tick
+struct BotCommand {
+    // Desired heading; only its direction counts, snapped to the eight the
+    // keyboard can produce
+    sf::Vector2f move;
+    // Offset from the tank centre to aim at
+    sf::Vector2f aim;
+    bool fire = false;
+};
+
+// Computer player. Bots see the World the way the game's HUD does and answer
+// with a BotCommand, which is turned into the same PlayerInput a human
+// produces, so bot matches can be recorded and replayed like any other.
+class BotController : public InputSource {
+public:
+    PlayerInput nextInput(const World& world) override;
+
+    virtual BotCommand decide(const World& world) = 0;
+
+    static PlayerInput toInput(const BotCommand& command);
+};
+
+// Stays put, turns to the nearest enemy and fires once one is within half a
+// screen. A baseline to compare smarter bots against.
+class TurretBot : public BotController {
+public:
+    BotCommand decide(const World& world) override;
+};
+
+// Bot by name: "turret" or "heuristic". Null for unknown names.
+std::unique_ptr<BotController> createBot(const std::string& name);
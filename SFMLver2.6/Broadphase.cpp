@@ -0,0 +1,103 @@
+#include "Broadphase.h"
+#include "BulletPool.h"
+#include "Block.h"
+#include "PlayerTank.h"
+#include "EnemyTank.h"
+#include <algorithm>
+#include <cmath>
+
+Broadphase::Broadphase(unsigned width, unsigned height, unsigned cell)
+    : columns(static_cast<int>((width + cell - 1) / cell)),
+    rows(static_cast<int>((height + cell - 1) / cell)),
+    cellSize(static_cast<float>(cell)), hasPlayer(false) {
+    tankCells.resize(static_cast<size_t>(columns) * rows);
+}
+
+int Broadphase::cellX(float x) const {
+    int cx = static_cast<int>(std::floor(x / cellSize));
+    return std::max(0, std::min(columns - 1, cx));
+}
+
+int Broadphase::cellY(float y) const {
+    int cy = static_cast<int>(std::floor(y / cellSize));
+    return std::max(0, std::min(rows - 1, cy));
+}
+
+void Broadphase::insertTank(size_t index, const sf::FloatRect& bounds) {
+    int maxX = cellX(bounds.left + bounds.width);
+    int maxY = cellY(bounds.top + bounds.height);
+    for (int y = cellY(bounds.top); y <= maxY; ++y) {
+        for (int x = cellX(bounds.left); x <= maxX; ++x) {
+            tankCells[y * columns + x].push_back(index);
+        }
+    }
+}
+
+void Broadphase::gatherTanks(const sf::FloatRect& area) {
+    scratch.clear();
+    int maxX = cellX(area.left + area.width);
+    int maxY = cellY(area.top + area.height);
+    for (int y = cellY(area.top); y <= maxY; ++y) {
+        for (int x = cellX(area.left); x <= maxX; ++x) {
+            const auto& cell = tankCells[y * columns + x];
+            scratch.insert(scratch.end(), cell.begin(), cell.end());
+        }
+    }
+    // Tanks spanning several cells show up more than once; keep enemy order
+    std::sort(scratch.begin(), scratch.end());
+    scratch.erase(std::unique(scratch.begin(), scratch.end()), scratch.end());
+}
+
+void Broadphase::build(const BulletPool& bullets,
+    const std::vector<std::unique_ptr<EnemyTank>>& enemies,
+    const PlayerTank* player, const BlockGrid& blocks) {
+
+    blockPairs.clear();
+    tankPairs.clear();
+    playerContacts.clear();
+    for (auto& cell : tankCells) {
+        cell.clear();
+    }
+
+    hasPlayer = player && !player->isDestroyed();
+    if (hasPlayer) {
+        playerBounds = player->getBounds();
+    }
+
+    enemyBounds.resize(enemies.size());
+    for (size_t i = 0; i < enemies.size(); ++i) {
+        if (!enemies[i] || enemies[i]->isDestroyed()) continue;
+
+        enemyBounds[i] = enemies[i]->getBounds();
+        insertTank(i, enemyBounds[i]);
+
+        if (hasPlayer && playerBounds.intersects(enemyBounds[i])) {
+            playerContacts.push_back(i);
+        }
+    }
+
+    for (size_t i = 0; i < bullets.size(); ++i) {
+        if (!bullets.isAlive(i)) continue;
+
+        sf::FloatRect bounds = bullets.getBounds(i);
+
+        blocks.forEachInArea(bounds, [&](Block& block) {
+            if (!block.isDestroyed() && block.isBlocking()) {
+                blockPairs.push_back({ i, &block });
+            }
+            return true;
+        });
+
+        if (bullets.isFromPlayer(i)) {
+            gatherTanks(bounds);
+            for (size_t enemy : scratch) {
+                if (bounds.intersects(enemyBounds[enemy])) {
+                    tankPairs.push_back({ i, enemy });
+                }
+            }
+        }
+        else if (hasPlayer && bounds.intersects(playerBounds)) {
+            tankPairs.push_back({ i, PLAYER });
+        }
+    }
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "BlockGrid.h"
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <memory>
+#include <limits>
+
+class BulletPool;
+class Block;
+class PlayerTank;
+class EnemyTank;
+
+// Per-frame collision broadphase. build() caches one AABB per tank, hashes
+// tanks into a coarse grid and emits the overlapping candidate pairs that
+// World::checkCollisions resolves. Each bullet's bounds are read once while
+// its pairs are emitted. Pairs are ordered by bullet index.
+class Broadphase {
+public:
+    static const size_t PLAYER = std::numeric_limits<size_t>::max();
+
+    struct BlockPair {
+        size_t bullet;
+        Block* block;
+    };
+
+    struct TankPair {
+        size_t bullet;
+        size_t tank;  // index into enemies, or PLAYER
+    };
+
+private:
+    int columns;
+    int rows;
+    float cellSize;
+    std::vector<std::vector<size_t>> tankCells;
+
+    std::vector<sf::FloatRect> enemyBounds;
+    sf::FloatRect playerBounds;
+    bool hasPlayer;
+
+    std::vector<BlockPair> blockPairs;
+    std::vector<TankPair> tankPairs;
+    std::vector<size_t> playerContacts;
+    std::vector<size_t> scratch;
+
+    int cellX(float x) const;
+    int cellY(float y) const;
+    void insertTank(size_t index, const sf::FloatRect& bounds);
+    void gatherTanks(const sf::FloatRect& area);
+
+public:
+    Broadphase(unsigned width = Constants::WORLD_WIDTH, unsigned height = Constants::WORLD_HEIGHT,
+        unsigned cell = 2 * Constants::BLOCK_SIZE);
+
+    void build(const BulletPool& bullets,
+        const std::vector<std::unique_ptr<EnemyTank>>& enemies,
+        const PlayerTank* player, const BlockGrid& blocks);
+
+    const std::vector<BlockPair>& getBlockPairs() const { return blockPairs; }
+    const std::vector<TankPair>& getTankPairs() const { return tankPairs; }
+    const std::vector<size_t>& getPlayerContacts() const { return playerContacts; }
+};
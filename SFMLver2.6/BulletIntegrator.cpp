@@ -0,0 +1,160 @@
+#include "BulletIntegrator.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define BULLET_INTEGRATOR_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define BULLET_TARGET_AVX
+#else
+#define BULLET_TARGET_AVX __attribute__((target("avx")))
+#endif
+#endif
+
+namespace {
+    using BulletIntegrator::Arrays;
+    using BulletIntegrator::Bounds;
+
+    inline void integrateRange(const Arrays& b, std::size_t begin, float dt, const Bounds& bounds) {
+        for (std::size_t i = begin; i < b.count; ++i) {
+            b.previousX[i] = b.x[i];
+            b.previousY[i] = b.y[i];
+            b.x[i] += b.velocityX[i] * dt;
+            b.y[i] += b.velocityY[i] * dt;
+
+            // Written as "not inside" so a NaN position is culled, the same as
+            // the ordered compares in the SIMD kernels
+            if (!(b.x[i] >= bounds.left && b.x[i] <= bounds.right &&
+                  b.y[i] >= bounds.top && b.y[i] <= bounds.bottom)) {
+                b.alive[i] = 0;
+            }
+        }
+    }
+
+    void integrateScalar(const Arrays& b, float dt, const Bounds& bounds) {
+        integrateRange(b, 0, dt, bounds);
+    }
+
+#ifdef BULLET_INTEGRATOR_X86
+    void integrateSse(const Arrays& b, float dt, const Bounds& bounds) {
+        const __m128 step = _mm_set1_ps(dt);
+        const __m128 left = _mm_set1_ps(bounds.left);
+        const __m128 top = _mm_set1_ps(bounds.top);
+        const __m128 right = _mm_set1_ps(bounds.right);
+        const __m128 bottom = _mm_set1_ps(bounds.bottom);
+
+        std::size_t i = 0;
+        for (; i + 4 <= b.count; i += 4) {
+            __m128 x = _mm_loadu_ps(b.x + i);
+            __m128 y = _mm_loadu_ps(b.y + i);
+            _mm_storeu_ps(b.previousX + i, x);
+            _mm_storeu_ps(b.previousY + i, y);
+
+            x = _mm_add_ps(x, _mm_mul_ps(_mm_loadu_ps(b.velocityX + i), step));
+            y = _mm_add_ps(y, _mm_mul_ps(_mm_loadu_ps(b.velocityY + i), step));
+            _mm_storeu_ps(b.x + i, x);
+            _mm_storeu_ps(b.y + i, y);
+
+            __m128 inside = _mm_and_ps(
+                _mm_and_ps(_mm_cmpge_ps(x, left), _mm_cmple_ps(x, right)),
+                _mm_and_ps(_mm_cmpge_ps(y, top), _mm_cmple_ps(y, bottom)));
+            int mask = _mm_movemask_ps(inside);
+            if (mask != 0xF) {
+                for (int lane = 0; lane < 4; ++lane) {
+                    if (!(mask & (1 << lane))) b.alive[i + lane] = 0;
+                }
+            }
+        }
+        integrateRange(b, i, dt, bounds);
+    }
+
+    BULLET_TARGET_AVX void integrateAvx(const Arrays& b, float dt, const Bounds& bounds) {
+        const __m256 step = _mm256_set1_ps(dt);
+        const __m256 left = _mm256_set1_ps(bounds.left);
+        const __m256 top = _mm256_set1_ps(bounds.top);
+        const __m256 right = _mm256_set1_ps(bounds.right);
+        const __m256 bottom = _mm256_set1_ps(bounds.bottom);
+
+        std::size_t i = 0;
+        for (; i + 8 <= b.count; i += 8) {
+            __m256 x = _mm256_loadu_ps(b.x + i);
+            __m256 y = _mm256_loadu_ps(b.y + i);
+            _mm256_storeu_ps(b.previousX + i, x);
+            _mm256_storeu_ps(b.previousY + i, y);
+
+            // Separate multiply and add so results match the other kernels bit for bit
+            x = _mm256_add_ps(x, _mm256_mul_ps(_mm256_loadu_ps(b.velocityX + i), step));
+            y = _mm256_add_ps(y, _mm256_mul_ps(_mm256_loadu_ps(b.velocityY + i), step));
+            _mm256_storeu_ps(b.x + i, x);
+            _mm256_storeu_ps(b.y + i, y);
+
+            __m256 inside = _mm256_and_ps(
+                _mm256_and_ps(_mm256_cmp_ps(x, left, _CMP_GE_OQ), _mm256_cmp_ps(x, right, _CMP_LE_OQ)),
+                _mm256_and_ps(_mm256_cmp_ps(y, top, _CMP_GE_OQ), _mm256_cmp_ps(y, bottom, _CMP_LE_OQ)));
+            int mask = _mm256_movemask_ps(inside);
+            if (mask != 0xFF) {
+                for (int lane = 0; lane < 8; ++lane) {
+                    if (!(mask & (1 << lane))) b.alive[i + lane] = 0;
+                }
+            }
+        }
+        integrateRange(b, i, dt, bounds);
+    }
+
+    bool cpuHasSse2() {
+#ifdef _MSC_VER
+        int info[4];
+        __cpuid(info, 1);
+        return (info[3] & (1 << 26)) != 0;
+#else
+        return __builtin_cpu_supports("sse2");
+#endif
+    }
+
+    bool cpuHasAvx() {
+#ifdef _MSC_VER
+        int info[4];
+        __cpuid(info, 1);
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool avx = (info[2] & (1 << 28)) != 0;
+        // The OS must also save the YMM registers on context switches
+        return osxsave && avx && (_xgetbv(0) & 0x6) == 0x6;
+#else
+        return __builtin_cpu_supports("avx");
+#endif
+    }
+#endif
+
+    BulletIntegrator::Kernel activeKernel = integrateScalar;
+    const char* activeName = "scalar";
+    bool selected = false;
+}
+
+void BulletIntegrator::select(bool allowSimd) {
+    activeKernel = integrateScalar;
+    activeName = "scalar";
+    selected = true;
+
+#ifdef BULLET_INTEGRATOR_X86
+    if (!allowSimd) return;
+
+    if (cpuHasAvx()) {
+        activeKernel = integrateAvx;
+        activeName = "avx";
+    }
+    else if (cpuHasSse2()) {
+        activeKernel = integrateSse;
+        activeName = "sse2";
+    }
+#endif
+}
+
+void BulletIntegrator::integrate(const Arrays& bullets, float deltaTime, const Bounds& bounds) {
+    if (!selected) select();
+    activeKernel(bullets, deltaTime, bounds);
+}
+
+const char* BulletIntegrator::getKernelName() {
+    if (!selected) select();
+    return activeName;
+}
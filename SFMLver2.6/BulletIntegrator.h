@@ -0,0 +1,35 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Integrates and bounds-culls bullets stored as structure-of-arrays. The
+// kernel is picked once at startup from what the CPU supports: AVX (8 lanes),
+// SSE2 (4 lanes) or a plain scalar loop. All kernels produce identical results,
+// and all of them cull a bullet whose position is NaN.
+namespace BulletIntegrator {
+    struct Arrays {
+        float* x;
+        float* y;
+        float* previousX;
+        float* previousY;
+        const float* velocityX;
+        const float* velocityY;
+        std::uint8_t* alive;
+        std::size_t count;
+    };
+
+    struct Bounds {
+        float left;
+        float top;
+        float right;
+        float bottom;
+    };
+
+    using Kernel = void (*)(const Arrays& bullets, float deltaTime, const Bounds& bounds);
+
+    // Chooses the widest supported kernel, or the scalar one when allowSimd is false
+    void select(bool allowSimd = true);
+
+    void integrate(const Arrays& bullets, float deltaTime, const Bounds& bounds);
+    const char* getKernelName();
+}
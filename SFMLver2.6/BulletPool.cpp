@@ -0,0 +1,143 @@
+#include "BulletPool.h"
+#include "BulletIntegrator.h"
+#include <cmath>
+
+BulletPool::BulletPool(size_t maxBullets) : capacity(maxBullets) {
+    x.reserve(capacity);
+    y.reserve(capacity);
+    previousX.reserve(capacity);
+    previousY.reserve(capacity);
+    velocityX.reserve(capacity);
+    velocityY.reserve(capacity);
+    radius.reserve(capacity);
+    damage.reserve(capacity);
+    fromPlayer.reserve(capacity);
+    alive.reserve(capacity);
+}
+
+bool BulletPool::spawn(sf::Vector2f pos, sf::Vector2f direction, float bulletRadius,
+    float speed, float bulletDamage, bool playerOwned) {
+    if (size() >= capacity) return false;
+
+    sf::Vector2f velocity(0, 0);
+    float len = std::sqrt(direction.x * direction.x + direction.y * direction.y);
+    if (len != 0) {
+        velocity = sf::Vector2f(direction.x / len * speed, direction.y / len * speed);
+    }
+
+    x.push_back(pos.x);
+    y.push_back(pos.y);
+    previousX.push_back(pos.x);
+    previousY.push_back(pos.y);
+    velocityX.push_back(velocity.x);
+    velocityY.push_back(velocity.y);
+    radius.push_back(bulletRadius);
+    damage.push_back(bulletDamage);
+    fromPlayer.push_back(playerOwned ? 1 : 0);
+    alive.push_back(1);
+    return true;
+}
+
+void BulletPool::update(float deltaTime, const sf::FloatRect& area) {
+    BulletIntegrator::Arrays arrays = {
+        x.data(), y.data(), previousX.data(), previousY.data(),
+        velocityX.data(), velocityY.data(), alive.data(), size()
+    };
+    BulletIntegrator::Bounds bounds = {
+        area.left, area.top, area.left + area.width, area.top + area.height
+    };
+    BulletIntegrator::integrate(arrays, deltaTime, bounds);
+}
+
+void BulletPool::removeDead() {
+    size_t count = size();
+    size_t kept = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (!alive[i]) continue;
+
+        if (kept != i) {
+            x[kept] = x[i];
+            y[kept] = y[i];
+            previousX[kept] = previousX[i];
+            previousY[kept] = previousY[i];
+            velocityX[kept] = velocityX[i];
+            velocityY[kept] = velocityY[i];
+            radius[kept] = radius[i];
+            damage[kept] = damage[i];
+            fromPlayer[kept] = fromPlayer[i];
+            alive[kept] = 1;
+        }
+        kept++;
+    }
+    if (kept == count) return;
+
+    x.resize(kept);
+    y.resize(kept);
+    previousX.resize(kept);
+    previousY.resize(kept);
+    velocityX.resize(kept);
+    velocityY.resize(kept);
+    radius.resize(kept);
+    damage.resize(kept);
+    fromPlayer.resize(kept);
+    alive.resize(kept);
+}
+
+void BulletPool::clear() {
+    x.clear();
+    y.clear();
+    previousX.clear();
+    previousY.clear();
+    velocityX.clear();
+    velocityY.clear();
+    radius.clear();
+    damage.clear();
+    fromPlayer.clear();
+    alive.clear();
+}
+
+sf::FloatRect BulletPool::getBounds(size_t index) const {
+    float r = radius[index];
+    return sf::FloatRect(x[index] - r, y[index] - r, r * 2.0f, r * 2.0f);
+}
+
+sf::Vector2f BulletPool::getInterpolatedPosition(size_t index, float alpha) const {
+    return sf::Vector2f(previousX[index] + (x[index] - previousX[index]) * alpha,
+        previousY[index] + (y[index] - previousY[index]) * alpha);
+}
+
+void BulletPool::saveState(SnapshotWriter& out) const {
+    out.writeArray(x);
+    out.writeArray(y);
+    out.writeArray(previousX);
+    out.writeArray(previousY);
+    out.writeArray(velocityX);
+    out.writeArray(velocityY);
+    out.writeArray(radius);
+    out.writeArray(damage);
+    out.writeArray(fromPlayer);
+    out.writeArray(alive);
+}
+
+bool BulletPool::loadState(SnapshotReader& in) {
+    in.readArray(x);
+    in.readArray(y);
+    in.readArray(previousX);
+    in.readArray(previousY);
+    in.readArray(velocityX);
+    in.readArray(velocityY);
+    in.readArray(radius);
+    in.readArray(damage);
+    in.readArray(fromPlayer);
+    in.readArray(alive);
+
+    size_t count = x.size();
+    bool consistent = count <= capacity && y.size() == count && previousX.size() == count &&
+        previousY.size() == count && velocityX.size() == count && velocityY.size() == count &&
+        radius.size() == count && damage.size() == count && fromPlayer.size() == count && alive.size() == count;
+    if (!in.ok() || !consistent) {
+        clear();
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "Constants.h"
+#include "Snapshot.h"
+#include <SFML/System/Vector2.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// Fixed-capacity bullet storage laid out as structure-of-arrays so the
+// integrator streams through contiguous floats (see BulletIntegrator). Memory
+// for every slot is reserved once at construction; live bullets are kept
+// packed at the front and removeDead() compacts them in place, so spawning
+// and destroying never touch the heap. When the pool is full new shots are
+// dropped.
+class BulletPool {
+private:
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> previousX;
+    std::vector<float> previousY;
+    std::vector<float> velocityX;
+    std::vector<float> velocityY;
+    std::vector<float> radius;
+    std::vector<float> damage;
+    std::vector<std::uint8_t> fromPlayer;
+    std::vector<std::uint8_t> alive;
+    size_t capacity;
+
+public:
+    explicit BulletPool(size_t maxBullets = Constants::MAX_BULLETS);
+
+    bool spawn(sf::Vector2f pos, sf::Vector2f direction, float bulletRadius,
+        float speed, float bulletDamage, bool playerOwned);
+    // Bullets leaving area are killed
+    void update(float deltaTime, const sf::FloatRect& area);
+    void removeDead();
+    void clear();
+
+    // Restoring never grows past the reserved capacity, so it does not allocate
+    void saveState(SnapshotWriter& out) const;
+    bool loadState(SnapshotReader& in);
+
+    size_t size() const { return x.size(); }
+    size_t getCapacity() const { return capacity; }
+
+    bool isAlive(size_t index) const { return alive[index] != 0; }
+    void kill(size_t index) { alive[index] = 0; }
+    bool isFromPlayer(size_t index) const { return fromPlayer[index] != 0; }
+    float getDamage(size_t index) const { return damage[index]; }
+    float getRadius(size_t index) const { return radius[index]; }
+    sf::Vector2f getPosition(size_t index) const { return sf::Vector2f(x[index], y[index]); }
+    sf::Vector2f getVelocity(size_t index) const { return sf::Vector2f(velocityX[index], velocityY[index]); }
+
+    sf::FloatRect getBounds(size_t index) const;
+    sf::Vector2f getInterpolatedPosition(size_t index, float alpha) const;
+};
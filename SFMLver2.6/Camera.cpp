@@ -0,0 +1,35 @@
+#include "Camera.h"
+#include <algorithm>
+
+Camera::Camera(sf::Vector2f viewSize) : view(viewSize / 2.0f, viewSize), limits(sf::Vector2f(0, 0), viewSize) {
+}
+
+void Camera::setLimits(const sf::FloatRect& area) {
+    limits = area;
+    follow(view.getCenter());
+}
+
+void Camera::follow(sf::Vector2f target) {
+    sf::Vector2f half = view.getSize() / 2.0f;
+    sf::Vector2f center;
+
+    if (limits.width <= half.x * 2.0f) {
+        center.x = limits.left + limits.width / 2.0f;
+    }
+    else {
+        center.x = std::max(limits.left + half.x, std::min(limits.left + limits.width - half.x, target.x));
+    }
+
+    if (limits.height <= half.y * 2.0f) {
+        center.y = limits.top + limits.height / 2.0f;
+    }
+    else {
+        center.y = std::max(limits.top + half.y, std::min(limits.top + limits.height - half.y, target.y));
+    }
+
+    view.setCenter(center);
+}
+
+sf::FloatRect Camera::getVisibleArea() const {
+    return sf::FloatRect(view.getCenter() - view.getSize() / 2.0f, view.getSize());
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include "Constants.h"
+#include <SFML/Graphics.hpp>
+
+// Window-sized view that follows a target across the world. The view never
+// shows anything outside the limits; a world smaller than the view is centred.
+class Camera {
+private:
+    sf::View view;
+    sf::FloatRect limits;
+
+public:
+    explicit Camera(sf::Vector2f viewSize = sf::Vector2f(
+        static_cast<float>(Constants::WINDOW_WIDTH), static_cast<float>(Constants::WINDOW_HEIGHT)));
+
+    void setLimits(const sf::FloatRect& area);
+    void follow(sf::Vector2f target);
+
+    const sf::View& getView() const { return view; }
+    sf::FloatRect getVisibleArea() const;
+};
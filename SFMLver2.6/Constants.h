@@ -7,13 +7,27 @@
 namespace Constants {
     const unsigned WINDOW_WIDTH = 800;
     const unsigned WINDOW_HEIGHT = 600;
+    // Playfield size; the camera scrolls over it when it is larger than the window
+    const unsigned WORLD_WIDTH = 1600;
+    const unsigned WORLD_HEIGHT = 1200;
     const unsigned BLOCK_SIZE = 40;
+    // Tilemap chunks are TILE_CHUNK_SIZE x TILE_CHUNK_SIZE tiles
+    const unsigned TILE_CHUNK_SIZE = 16;
+
+    // Simulation runs at a fixed rate; rendering interpolates between ticks
+    const unsigned TICK_RATE = 60;
+    const unsigned MAX_CATCH_UP_STEPS = 5;
+    const unsigned FRAMERATE_LIMIT = 60;  // 0 renders uncapped
+    const bool VSYNC_ENABLED = false;
 
     const float PLAYER_SPEED = 200.0f;
     const float ENEMY_SPEED = 120.0f;
     const float BULLET_SPEED = 600.0f;
     const float ENEMY_BULLET_SPEED = 400.0f;
 
+    // Bullet slots reserved up front; shots beyond this are dropped
+    const unsigned MAX_BULLETS = 4096;
+
     const float PLAYER_HEALTH = 100.0f;
     const float ENEMY_HEALTH = 100.0f;
     const float WALL_HEALTH = 1000.0f;
@@ -27,6 +41,11 @@ namespace Constants {
 
     const float ENEMY_SPAWN_INTERVAL = 3.0f;
     const float AI_UPDATE_INTERVAL = 2.0f;
+    // Enemies on screen think once every AI_THINK_BUCKETS ticks, off-screen ones
+    // AI_FAR_THINK_FACTOR times less often; at most AI_THINK_BUDGET thinks per tick
+    const unsigned AI_THINK_BUCKETS = 4;
+    const unsigned AI_FAR_THINK_FACTOR = 4;
+    const unsigned AI_THINK_BUDGET = 64;
     const float ENEMY_DETECTION_RANGE = 300.0f;
     const float ENEMY_MIN_DISTANCE = 100.0f;
     const float ENEMY_MAX_DISTANCE = 150.0f;
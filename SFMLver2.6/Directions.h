@@ -0,0 +1,63 @@
+#pragma once
+
+// Headings an enemy may drive in, as unit vectors in screen space (y down).
+// The table is ordered by angle, so neighbouring entries (wrapping around)
+// are the nearest alternatives to a heading.
+namespace Directions {
+    struct Direction {
+        float x;
+        float y;
+    };
+
+    constexpr float HALF_SQRT2 = 0.70710678f;
+    constexpr float HALF_SQRT3 = 0.86602540f;
+
+    constexpr Direction TABLE[] = {
+        { 1.0f, 0.0f },                 // 0 degrees
+        { HALF_SQRT3, 0.5f },           // 30
+        { HALF_SQRT2, HALF_SQRT2 },     // 45
+        { 0.0f, 1.0f },                 // 90
+        { -HALF_SQRT2, HALF_SQRT2 },    // 135
+        { -1.0f, 0.0f },                // 180
+        { -HALF_SQRT2, -HALF_SQRT2 },   // -135
+        { 0.0f, -1.0f },                // -90
+        { HALF_SQRT2, -HALF_SQRT2 }     // -45
+    };
+
+    constexpr int COUNT = static_cast<int>(sizeof(TABLE) / sizeof(TABLE[0]));
+
+    // tan() of the halfway angles between neighbouring table entries
+    constexpr float TAN_15 = 0.26794919f;
+    constexpr float TAN_22_5 = 0.41421356f;
+    constexpr float TAN_37_5 = 0.76732699f;
+    constexpr float TAN_67_5 = 2.41421356f;
+
+    // Index of the entry closest in angle to (x, y), found from the octant and
+    // a few slope compares instead of atan2. A zero vector maps to 0 degrees.
+    inline int classify(float x, float y) {
+        float ax = x < 0 ? -x : x;
+        float ay = y < 0 ? -y : y;
+
+        if (y > 0 && x >= 0) {
+            // Only this quadrant has the extra 30 degree heading
+            if (ay <= ax * TAN_15) return 0;
+            if (ay <= ax * TAN_37_5) return 1;
+            if (ay <= ax * TAN_67_5) return 2;
+            return 3;
+        }
+
+        // Everywhere else the headings are 45 degrees apart
+        bool mostlyHorizontal = ay <= ax * TAN_22_5;
+        bool mostlyVertical = ax < ay * TAN_22_5;
+        if (y > 0) {
+            if (mostlyVertical) return 3;
+            return mostlyHorizontal ? 5 : 4;
+        }
+        if (x < 0) {
+            if (mostlyHorizontal) return 5;
+            return mostlyVertical ? 7 : 6;
+        }
+        if (mostlyHorizontal) return 0;
+        return mostlyVertical ? 7 : 8;
+    }
+}
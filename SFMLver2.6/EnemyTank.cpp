@@ -1,53 +1,81 @@
 #include "EnemyTank.h"
 #include "PlayerTank.h"
+#include "FlowField.h"
 #include "Block.h"
+#include "ResourceManager.h"
+#include "Directions.h"
 #include <cmath>
 #include <cstdlib>
-#include <vector>
 
-float quantizeAngle(float angleDegrees);
-
-EnemyTank::EnemyTank(sf::Vector2f pos, PlayerTank* playerRef, std::vector<std::unique_ptr<Bullet>>* bullets)
+EnemyTank::EnemyTank(sf::Vector2f pos, PlayerTank* playerRef, BulletPool* bullets, const FlowField* field,
+    const Tuning* values)
     : BaseTank(pos, Constants::ENEMY_SPEED, sf::Color::Red, bullets),
-    player(playerRef), aiTimer(0.0f) {
+    useTexture(false), player(playerRef), flowField(field), aiTimer(0.0f), hasThought(false), thinkOverdue(false) {
 
-    if (texture.loadFromFile("assets/EnemyTank.png")) {
+    ResourceManager::TextureRegion region = ResourceManager::instance().getTextureRegion("assets/EnemyTank.png");
+    if (region.texture) {
         useTexture = true;
-        sprite.setTexture(texture);
+        sprite.setTexture(*region.texture);
+        sprite.setTextureRect(region.rect);
         sprite.setScale(0.07f, 0.07f);
-        sprite.setOrigin(static_cast<float>(texture.getSize().x) / 2.0f,
-            static_cast<float>(texture.getSize().y) / 2.0f);
+        sprite.setOrigin(static_cast<float>(region.rect.width) / 2.0f,
+            static_cast<float>(region.rect.height) / 2.0f);
         sprite.setPosition(pos);
     }
 
-    maxAttackCooldown = Constants::ENEMY_ATTACK_COOLDOWN;
+    setTuning(values);
+    speed = tuning->enemySpeed;
+    maxAttackCooldown = tuning->enemyAttackCooldown;
+    health = maxHealth = tuning->enemyHealth;
     targetDirection = sf::Vector2f(0, 0);
 }
 
 void EnemyTank::update(float deltaTime) {
     if (destroyed || !player || player->isDestroyed()) return;
 
+    // Steering comes from the last think(); only timers and the hull advance here
     aiTimer += deltaTime;
 
+    BaseTank::update(deltaTime);
+
+    if (useTexture) {
+        sprite.setRotation(rotation + 90.f);
+    }
+}
+
+void EnemyTank::think(AITier tier) {
+    hasThought = true;
+    thinkOverdue = false;
+    if (destroyed || !player || player->isDestroyed()) return;
+
     sf::Vector2f playerPos = player->getCenter();
     sf::Vector2f direction = playerPos - position;
     float distance = sqrt(direction.x * direction.x + direction.y * direction.y);
 
     if (distance > 0) {
-        float angleRad = atan2(direction.y, direction.x);
-        float angleDeg = angleRad * 180.0f / static_cast<float>(M_PI);
-
-        setRotation(angleDeg);
-
-        float quantizedAngle = quantizeAngle(angleDeg);
-        float quantizedRad = quantizedAngle * static_cast<float>(M_PI) / 180.0f;
-        sf::Vector2f quantizedDir(cos(quantizedRad), sin(quantizedRad));
+        // Reduced-tier enemies are off screen: no turret angle and no quantizing
+        sf::Vector2f moveDir = direction / distance;
+        if (tier == AITier::FULL) {
+            // The turret still tracks the exact angle; driving snaps to the table
+            float angleRad = atan2(direction.y, direction.x);
+            setRotation(angleRad * 180.0f / static_cast<float>(M_PI));
+
+            const Directions::Direction& snapped = Directions::TABLE[Directions::classify(direction.x, direction.y)];
+            moveDir = sf::Vector2f(snapped.x, snapped.y);
+        }
 
-        if (distance > Constants::ENEMY_MAX_DISTANCE) {
-            targetDirection = quantizedDir;
+        sf::Vector2f waypoint;
+        if (distance > tuning->enemyMaxDistance && flowField && flowField->getNextWaypoint(position, waypoint)) {
+            // Heading for the next cell's centre keeps the hull clear of corners
+            sf::Vector2f toWaypoint = waypoint - position;
+            float length = sqrt(toWaypoint.x * toWaypoint.x + toWaypoint.y * toWaypoint.y);
+            targetDirection = length > 0 ? toWaypoint / length : moveDir;
+        }
+        else if (distance > tuning->enemyMaxDistance) {
+            targetDirection = moveDir;
         }
-        else if (distance < Constants::ENEMY_MIN_DISTANCE) {
-            targetDirection = -quantizedDir;
+        else if (distance < tuning->enemyMinDistance) {
+            targetDirection = -moveDir;
         }
         else {
             targetDirection = sf::Vector2f(0, 0);
@@ -59,61 +87,64 @@ void EnemyTank::update(float deltaTime) {
 
     velocity = targetDirection * speed;
 
-    if (aiTimer >= Constants::AI_UPDATE_INTERVAL && distance < Constants::ENEMY_DETECTION_RANGE) {
+    if (aiTimer >= tuning->aiUpdateInterval && distance < tuning->enemyDetectionRange) {
         attack(playerPos);
         aiTimer = 0.0f;
     }
+}
 
-    BaseTank::update(deltaTime);
+void EnemyTank::setPosition(sf::Vector2f pos) {
+    BaseTank::setPosition(pos);
+    sprite.setPosition(pos);
+}
+
+
+void EnemyTank::bind(PlayerTank* playerRef, BulletPool* bullets, const FlowField* field, const Tuning* values) {
+    player = playerRef;
+    bulletContainer = bullets;
+    flowField = field;
+    setTuning(values);
+}
 
+void EnemyTank::saveState(SnapshotWriter& out) const {
+    BaseTank::saveState(out);
+    out.write(aiTimer);
+    out.write(targetDirection);
+    out.writeFlag(hasThought);
+    out.writeFlag(thinkOverdue);
+}
+
+void EnemyTank::loadState(SnapshotReader& in) {
+    BaseTank::loadState(in);
+    in.read(aiTimer);
+    in.read(targetDirection);
+    hasThought = in.readFlag();
+    thinkOverdue = in.readFlag();
     if (useTexture) {
-        sprite.setPosition(position);
         sprite.setRotation(rotation + 90.f);
     }
 }
 
-
-void EnemyTank::updateMovement(float deltaTime, const std::vector<std::unique_ptr<Block>>& blocks) {
+void EnemyTank::updateMovement(float deltaTime, const BlockGrid& blocks, const sf::FloatRect& area) {
     if (destroyed) return;
 
-    sf::Vector2f newPos = position + velocity * deltaTime;
-
-    newPos.x = std::max(20.0f, std::min(780.0f, newPos.x));
-    newPos.y = std::max(20.0f, std::min(580.0f, newPos.y));
+    sf::Vector2f newPos = clampToArea(position + velocity * deltaTime, area);
 
     if (canMoveTo(newPos, blocks)) {
         setPosition(newPos);
     } else {
-        float angleRad = atan2(targetDirection.y, targetDirection.x);
-        float angleDeg = angleRad * 180.0f / static_cast<float>(M_PI);
-
-        static const std::vector<float> allowedAngles = {30, 45, -45, 90, -90, 135, -135, 0, 180, -180};
-
-        int bestIdx = 0;
-        float minDiff = std::abs(angleDeg - allowedAngles[0]);
-        for (int i = 1; i < allowedAngles.size(); ++i) {
-            float diff = std::abs(angleDeg - allowedAngles[i]);
-            if (diff < minDiff) {
-                minDiff = diff;
-                bestIdx = i;
-            }
-        }
-
-        for (int offset = 1; offset < allowedAngles.size(); ++offset) {
-            for (int sign = -1; sign <= 1; sign += 2) {
-                int idx = (bestIdx + sign * offset + allowedAngles.size()) % allowedAngles.size();
-                float tryAngle = allowedAngles[idx];
-                float tryRad = tryAngle * static_cast<float>(M_PI) / 180.0f;
-                sf::Vector2f tryDir(cos(tryRad), sin(tryRad));
-                sf::Vector2f tryPos = position + tryDir * speed * deltaTime;
-                tryPos.x = std::max(20.0f, std::min(780.0f, tryPos.x));
-                tryPos.y = std::max(20.0f, std::min(580.0f, tryPos.y));
-                if (canMoveTo(tryPos, blocks)) {
-                    targetDirection = tryDir;
-                    velocity = targetDirection * speed;
-                    setPosition(tryPos);
-                    return;
-                }
+        // Try the table headings nearest the blocked one first: 0, +1, -1, +2, ...
+        int best = Directions::classify(targetDirection.x, targetDirection.y);
+        for (int step = 0; step < Directions::COUNT; ++step) {
+            int offset = (step + 1) / 2;
+            int idx = (best + (step % 2 == 1 ? offset : -offset) + Directions::COUNT) % Directions::COUNT;
+            sf::Vector2f tryDir(Directions::TABLE[idx].x, Directions::TABLE[idx].y);
+            sf::Vector2f tryPos = clampToArea(position + tryDir * speed * deltaTime, area);
+            if (canMoveTo(tryPos, blocks)) {
+                targetDirection = tryDir;
+                velocity = targetDirection * speed;
+                setPosition(tryPos);
+                return;
             }
         }
         velocity = sf::Vector2f(0, 0);
@@ -122,34 +153,19 @@ void EnemyTank::updateMovement(float deltaTime, const std::vector<std::unique_pt
 
 void EnemyTank::createBullet(sf::Vector2f target) {
     sf::Vector2f direction = target - position;
-    auto bullet = std::make_unique<Bullet>(position, direction, 5.0f,
-        sf::Color::Cyan, Constants::ENEMY_BULLET_SPEED,
-        Constants::ENEMY_BULLET_DAMAGE, false);
-    bulletContainer->push_back(std::move(bullet));
-}
-
-float quantizeAngle(float angleDegrees) {
-    static const std::vector<float> allowedAngles = {30, 45, -45, 90, -90, 135, -135, 0, 180, -180};
-    float closest = allowedAngles[0];
-    float minDiff = std::abs(angleDegrees - closest);
-    for (float a : allowedAngles) {
-        float diff = std::abs(angleDegrees - a);
-        if (diff < minDiff) {
-            minDiff = diff;
-            closest = a;
-        }
-    }
-    return closest;
+    bulletContainer->spawn(position, direction, 5.0f,
+        tuning->enemyBulletSpeed, tuning->enemyBulletDamage, false);
 }
 
-void EnemyTank::draw(sf::RenderWindow& window) {
+void EnemyTank::draw(SpriteBatch& batch, float alpha) {
     if (!destroyed) {
+        sf::Transform offset = getRenderOffset(alpha);
         if (useTexture) {
-            window.draw(sprite);
+            batch.draw(sprite, LAYER_TANKS, offset);
         }
         else {
-            window.draw(body);
+            batch.draw(body, LAYER_TANKS, offset);
         }
-        drawHealthBar(window);
+        drawHealthBar(batch, offset);
     }
 }
\ No newline at end of file
@@ -3,25 +3,49 @@
 #include <SFML/Graphics.hpp>
 
 class PlayerTank;
+class FlowField;
+
+// How much work an enemy's think() does. REDUCED skips turret aiming and
+// direction quantizing for enemies the player cannot see.
+enum class AITier { FULL, REDUCED };
 
 class EnemyTank : public BaseTank {
 private:
-    sf::Texture texture;
     sf::Sprite sprite;
     bool useTexture;
 
     PlayerTank* player;
+    const FlowField* flowField;
     float aiTimer;
     sf::Vector2f targetDirection;
+    bool hasThought;
+    // Was due to think but the scheduler's budget ran out
+    bool thinkOverdue;
 
 public:
-    EnemyTank(sf::Vector2f pos, PlayerTank* playerRef, std::vector<std::unique_ptr<Bullet>>* bullets);
+    EnemyTank(sf::Vector2f pos, PlayerTank* playerRef, BulletPool* bullets, const FlowField* field = nullptr,
+        const Tuning* values = nullptr);
 
     void update(float deltaTime) override;
 
-    void updateMovement(float deltaTime, const std::vector<std::unique_ptr<class Block>>& blocks);
+    // Picks a new heading and decides whether to fire. Called by AIScheduler,
+    // usually less often than update()
+    void think(AITier tier);
+    bool needsFirstThink() const { return !hasThought; }
+    bool isThinkOverdue() const { return thinkOverdue; }
+    void markThinkOverdue() { thinkOverdue = true; }
+
+    void updateMovement(float deltaTime, const BlockGrid& blocks, const sf::FloatRect& area);
+
+    void setPosition(sf::Vector2f pos) override;
+
+    // Points the tank at the World objects it reads and writes
+    void bind(PlayerTank* playerRef, BulletPool* bullets, const FlowField* field, const Tuning* values);
+
+    void saveState(SnapshotWriter& out) const override;
+    void loadState(SnapshotReader& in) override;
 
-    void draw(sf::RenderWindow& window) override;
+    void draw(SpriteBatch& batch, float alpha) override;
 
 protected:
     void createBullet(sf::Vector2f target) override;
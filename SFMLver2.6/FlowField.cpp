@@ -0,0 +1,177 @@
+#include "FlowField.h"
+#include "Tilemap.h"
+#include <algorithm>
+#include <functional>
+#include <cmath>
+
+namespace {
+    // East first, then clockwise; direction k and (k + 4) % 8 are opposite
+    const int DIRECTION_X[8] = { 1, 1, 0, -1, -1, -1, 0, 1 };
+    const int DIRECTION_Y[8] = { 0, 1, 1, 1, 0, -1, -1, -1 };
+    const unsigned STRAIGHT_COST = 10;
+    const unsigned DIAGONAL_COST = 14;
+
+    using HeapEntry = std::pair<unsigned, int>;
+}
+
+FlowField::FlowField(unsigned width, unsigned height, unsigned cell)
+    : columns(static_cast<int>((width + cell - 1) / cell)),
+    rows(static_cast<int>((height + cell - 1) / cell)),
+    cellSize(static_cast<float>(cell)), target(-1, -1), dirty(true), rebuilds(0), incrementalUpdates(0) {
+    size_t count = static_cast<size_t>(columns) * rows;
+    passable.assign(count, 1);
+    cost.assign(count, UNREACHABLE);
+    next.assign(count, -1);
+    heap.reserve(count);
+}
+
+bool FlowField::canStep(int x, int y, int direction) const {
+    int nx = x + DIRECTION_X[direction];
+    int ny = y + DIRECTION_Y[direction];
+    if (nx < 0 || ny < 0 || nx >= columns || ny >= rows) return false;
+    if (!passable[ny * columns + nx]) return false;
+
+    // A tank cannot squeeze diagonally between two blocked corners
+    if (direction % 2 == 1) {
+        return passable[y * columns + nx] && passable[ny * columns + x];
+    }
+    return true;
+}
+
+void FlowField::push(unsigned distance, int index) {
+    heap.emplace_back(distance, index);
+    std::push_heap(heap.begin(), heap.end(), std::greater<HeapEntry>());
+}
+
+void FlowField::relax() {
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<HeapEntry>());
+        HeapEntry entry = heap.back();
+        heap.pop_back();
+
+        int index = entry.second;
+        if (entry.first > cost[index]) continue;
+
+        int x = index % columns;
+        int y = index / columns;
+        for (int k = 0; k < 8; ++k) {
+            if (!canStep(x, y, k)) continue;
+
+            int neighbour = (y + DIRECTION_Y[k]) * columns + x + DIRECTION_X[k];
+            unsigned distance = entry.first + (k % 2 == 0 ? STRAIGHT_COST : DIAGONAL_COST);
+            if (distance < cost[neighbour]) {
+                cost[neighbour] = distance;
+                next[neighbour] = static_cast<std::int8_t>((k + 4) % 8);
+                push(distance, neighbour);
+            }
+        }
+    }
+}
+
+void FlowField::rebuild() {
+    std::fill(cost.begin(), cost.end(), UNREACHABLE);
+    std::fill(next.begin(), next.end(), -1);
+    heap.clear();
+    dirty = false;
+    rebuilds++;
+
+    if (target.x < 0 || target.y < 0 || target.x >= columns || target.y >= rows) return;
+
+    int index = target.y * columns + target.x;
+    cost[index] = 0;
+    push(0, index);
+    relax();
+}
+
+void FlowField::setObstacles(const Tilemap& tilemap) {
+    for (int y = 0; y < rows; ++y) {
+        for (int x = 0; x < columns; ++x) {
+            bool blocked = tilemap.hasTile(x, y) && getBlockStyle(tilemap.getTile(x, y)).blocking;
+            passable[y * columns + x] = blocked ? 0 : 1;
+        }
+    }
+    dirty = true;
+}
+
+void FlowField::openCell(int x, int y) {
+    if (x < 0 || y < 0 || x >= columns || y >= rows) return;
+
+    int index = y * columns + x;
+    if (passable[index]) return;
+    passable[index] = 1;
+    if (dirty) return;
+
+    // Opening a cell only ever shortens paths. Re-relaxing from its
+    // neighbours also picks up diagonals the cell used to block.
+    heap.clear();
+    for (int k = 0; k < 8; ++k) {
+        int nx = x + DIRECTION_X[k];
+        int ny = y + DIRECTION_Y[k];
+        if (nx < 0 || ny < 0 || nx >= columns || ny >= rows) continue;
+
+        int neighbour = ny * columns + nx;
+        if (passable[neighbour] && cost[neighbour] != UNREACHABLE) {
+            push(cost[neighbour], neighbour);
+        }
+    }
+    relax();
+    incrementalUpdates++;
+}
+
+void FlowField::setTarget(sf::Vector2f position) {
+    sf::Vector2i cell(static_cast<int>(std::floor(position.x / cellSize)),
+        static_cast<int>(std::floor(position.y / cellSize)));
+    if (!dirty && cell == target) return;
+
+    target = cell;
+    rebuild();
+}
+
+bool FlowField::getNextWaypoint(sf::Vector2f position, sf::Vector2f& waypoint) const {
+    int x = static_cast<int>(std::floor(position.x / cellSize));
+    int y = static_cast<int>(std::floor(position.y / cellSize));
+    if (x < 0 || y < 0 || x >= columns || y >= rows) return false;
+
+    int direction = next[y * columns + x];
+    if (direction < 0) return false;
+
+    waypoint = sf::Vector2f((x + DIRECTION_X[direction] + 0.5f) * cellSize,
+        (y + DIRECTION_Y[direction] + 0.5f) * cellSize);
+    return true;
+}
+
+void FlowField::saveState(SnapshotWriter& out) const {
+    out.write(columns);
+    out.write(rows);
+    out.writeArray(passable);
+    out.writeArray(cost);
+    out.writeArray(next);
+    out.write(target);
+    out.writeFlag(dirty);
+    out.write(rebuilds);
+    out.write(incrementalUpdates);
+}
+
+bool FlowField::loadState(SnapshotReader& in) {
+    int savedColumns = in.read<int>();
+    int savedRows = in.read<int>();
+    if (savedColumns != columns || savedRows != rows) return false;
+
+    in.readArray(passable);
+    in.readArray(cost);
+    in.readArray(next);
+    in.read(target);
+    dirty = in.readFlag();
+    in.read(rebuilds);
+    in.read(incrementalUpdates);
+
+    size_t count = static_cast<size_t>(columns) * rows;
+    if (!in.ok() || passable.size() != count || cost.size() != count || next.size() != count) {
+        passable.assign(count, 1);
+        cost.assign(count, UNREACHABLE);
+        next.assign(count, -1);
+        dirty = true;
+        return false;
+    }
+    return true;
+}
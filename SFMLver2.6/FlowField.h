@@ -0,0 +1,59 @@
+#pragma once
+#include "Constants.h"
+#include "Snapshot.h"
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+class Tilemap;
+
+// Shortest-path field toward one target cell over the tile grid, shared by
+// every enemy. Each passable cell stores its distance to the target and the
+// neighbour to step to next, so following the field is one lookup per
+// enemy. The field is rebuilt (Dijkstra, 8-neighbour, no corner cutting) when
+// the target changes cell; opening a cell only relaxes the distances it
+// shortens.
+class FlowField {
+private:
+    static constexpr unsigned UNREACHABLE = 0xFFFFFFFFu;
+
+    int columns;
+    int rows;
+    float cellSize;
+    std::vector<std::uint8_t> passable;
+    std::vector<unsigned> cost;
+    std::vector<std::int8_t> next;  // direction index toward the target, -1 if none
+    std::vector<std::pair<unsigned, int>> heap;  // reused between updates
+
+    sf::Vector2i target;
+    bool dirty;
+    unsigned rebuilds;
+    unsigned incrementalUpdates;
+
+    bool canStep(int x, int y, int direction) const;
+    void push(unsigned distance, int index);
+    void relax();
+    void rebuild();
+
+public:
+    FlowField(unsigned width = Constants::WORLD_WIDTH, unsigned height = Constants::WORLD_HEIGHT,
+        unsigned cell = Constants::BLOCK_SIZE);
+
+    // Takes the blocking tiles from the map; the next setTarget() rebuilds
+    void setObstacles(const Tilemap& tilemap);
+    void openCell(int x, int y);
+    void setTarget(sf::Vector2f position);
+
+    // Centre of the cell to head for from position. False when position is
+    // in the target cell or cannot reach it.
+    bool getNextWaypoint(sf::Vector2f position, sf::Vector2f& waypoint) const;
+
+    // The field is saved rather than recomputed on restore: an incremental
+    // update can break ties differently from a full rebuild
+    void saveState(SnapshotWriter& out) const;
+    bool loadState(SnapshotReader& in);
+
+    unsigned getRebuilds() const { return rebuilds; }
+    unsigned getIncrementalUpdates() const { return incrementalUpdates; }
+};
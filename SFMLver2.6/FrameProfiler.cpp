@@ -0,0 +1,124 @@
+#include "FrameProfiler.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <ostream>
+
+namespace {
+    const double BUCKETS_PER_DOUBLING = 8.0;
+}
+
+const char* getSectionName(int section) {
+    static const char* const NAMES[SECTION_COUNT] = {
+        "events", "update", "render", "present", "frame"
+    };
+    return section >= 0 && section < SECTION_COUNT ? NAMES[section] : "unknown";
+}
+
+TimingHistogram::TimingHistogram() {
+    clear();
+}
+
+int TimingHistogram::bucketOf(double ms) {
+    // Bucket 0 holds everything under a microsecond
+    double us = ms * 1000.0;
+    if (us < 1.0) return 0;
+    int bucket = static_cast<int>(std::log2(us) * BUCKETS_PER_DOUBLING) + 1;
+    return std::min(bucket, BUCKETS - 1);
+}
+
+void TimingHistogram::add(double ms) {
+    if (count == WINDOW) {
+        sum -= samples[next];
+        counts[sampleBuckets[next]]--;
+    }
+    else {
+        count++;
+    }
+
+    int bucket = bucketOf(ms);
+    samples[next] = static_cast<float>(ms);
+    sampleBuckets[next] = static_cast<std::uint8_t>(bucket);
+    counts[bucket]++;
+    sum += samples[next];
+    next = (next + 1) % WINDOW;
+}
+
+void TimingHistogram::clear() {
+    std::fill(std::begin(counts), std::end(counts), 0u);
+    next = 0;
+    count = 0;
+    sum = 0.0;
+}
+
+double TimingHistogram::getPercentile(double fraction) const {
+    if (count == 0) return 0.0;
+
+    size_t rank = static_cast<size_t>(std::ceil(fraction * count));
+    size_t seen = 0;
+    int bucket = 0;
+    for (; bucket < BUCKETS - 1; ++bucket) {
+        seen += counts[bucket];
+        if (seen >= rank) break;
+    }
+    return std::exp2(bucket / BUCKETS_PER_DOUBLING) / 1000.0;
+}
+
+FrameProfiler::FrameProfiler() : enabled(false) {
+    std::fill(std::begin(pending), std::end(pending), 0.0);
+    std::fill(std::begin(lastPhaseSeconds), std::end(lastPhaseSeconds), 0.0);
+}
+
+void FrameProfiler::setEnabled(bool on, World& world) {
+    enabled = on;
+    world.setProfiling(on);
+    if (!on) return;
+
+    // Start from a clean window so stale samples do not skew the first readings
+    for (TimingHistogram& histogram : sections) histogram.clear();
+    for (TimingHistogram& histogram : phases) histogram.clear();
+    std::fill(std::begin(pending), std::end(pending), 0.0);
+    for (int phase = 0; phase < PHASE_COUNT; ++phase) {
+        lastPhaseSeconds[phase] = world.getPhaseSeconds(phase);
+    }
+    frameStart = Clock::now();
+}
+
+void FrameProfiler::endFrame(const World& world) {
+    if (!enabled) return;
+
+    Clock::time_point now = Clock::now();
+    pending[SECTION_FRAME] = std::chrono::duration<double, std::milli>(now - frameStart).count();
+    frameStart = now;
+    for (int section = 0; section < SECTION_COUNT; ++section) {
+        sections[section].add(pending[section]);
+        pending[section] = 0.0;
+    }
+
+    for (int phase = 0; phase < PHASE_COUNT; ++phase) {
+        // The totals only go down when something called resetProfile()
+        double seconds = world.getPhaseSeconds(phase);
+        double spent = seconds >= lastPhaseSeconds[phase] ? seconds - lastPhaseSeconds[phase] : seconds;
+        phases[phase].add(spent * 1000.0);
+        lastPhaseSeconds[phase] = seconds;
+    }
+}
+
+void FrameProfiler::writeReport(std::ostream& out) const {
+    std::ios::fmtflags flags = out.flags();
+    out << std::fixed << std::setprecision(3) << std::left << std::setw(14) << "ms/frame" << std::right
+        << std::setw(8) << "avg" << std::setw(8) << "p99" << "\n";
+    for (int section = 0; section < SECTION_COUNT; ++section) {
+        out << std::left << std::setw(14) << getSectionName(section) << std::right
+            << std::setw(8) << sections[section].getAverage()
+            << std::setw(8) << sections[section].getPercentile(0.99) << "\n";
+
+        if (section != SECTION_UPDATE) continue;
+        for (int phase = 0; phase < PHASE_COUNT; ++phase) {
+            out << "  " << std::left << std::setw(12) << getPhaseName(phase) << std::right
+                << std::setw(8) << phases[phase].getAverage()
+                << std::setw(8) << phases[phase].getPercentile(0.99) << "\n";
+        }
+    }
+    out.flags(flags);
+}
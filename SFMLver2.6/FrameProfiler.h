@@ -0,0 +1,109 @@
+#pragma once
+#include "World.h"
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <iosfwd>
+
+// Durations of one timed section over the last WINDOW frames. Samples are
+// also counted into log-scale buckets (eight per doubling from 1 us up to
+// 2^(207/8) us, about a minute, with anything longer in the last bucket), so a
+// percentile is one walk over the buckets instead of a sort, accurate to
+// within a bucket (about 9%).
+class TimingHistogram {
+public:
+    static constexpr size_t WINDOW = 240;
+    // Must stay within what sampleBuckets' std::uint8_t can index
+    static constexpr int BUCKETS = 208;
+
+private:
+    float samples[WINDOW];
+    std::uint8_t sampleBuckets[WINDOW];
+    unsigned counts[BUCKETS];
+    size_t next;
+    size_t count;
+    double sum;
+
+    static int bucketOf(double ms);
+
+public:
+    TimingHistogram();
+
+    void add(double ms);
+    void clear();
+
+    size_t getCount() const { return count; }
+    double getAverage() const { return count > 0 ? sum / count : 0.0; }
+    // Upper edge of the bucket holding the given fraction of the window
+    double getPercentile(double fraction) const;
+};
+
+// Parts of a rendered frame timed by the profiler. UPDATE spans every tick
+// the frame ran; its breakdown comes from the World's own phase timers.
+enum FrameSection {
+    SECTION_EVENTS = 0,
+    SECTION_UPDATE,
+    SECTION_RENDER,
+    SECTION_PRESENT,
+    SECTION_FRAME,
+    SECTION_COUNT
+};
+
+const char* getSectionName(int section);
+
+// Per-frame timings for the F3 overlay. Disabled it costs one branch per
+// timed scope: no clock is read and the World's phase timers stay off.
+class FrameProfiler {
+private:
+    using Clock = std::chrono::steady_clock;
+
+    bool enabled;
+    Clock::time_point frameStart;
+    double pending[SECTION_COUNT];
+    double lastPhaseSeconds[PHASE_COUNT];
+    TimingHistogram sections[SECTION_COUNT];
+    TimingHistogram phases[PHASE_COUNT];
+
+public:
+    FrameProfiler();
+
+    // Also switches the World's phase timers, which feed the update breakdown
+    void setEnabled(bool on, World& world);
+    bool isEnabled() const { return enabled; }
+
+    void add(FrameSection section, double ms) { pending[section] += ms; }
+    // Files this frame's section times and the World phase time spent since
+    // the previous call as one sample each
+    void endFrame(const World& world);
+
+    const TimingHistogram& getSection(int section) const { return sections[section]; }
+    const TimingHistogram& getPhase(int phase) const { return phases[phase]; }
+
+    // One "name avg p99" line per section, with the World phases under update
+    void writeReport(std::ostream& out) const;
+};
+
+// Charges the lifetime of the scope to a section of the current frame
+class ScopedTimer {
+private:
+    FrameProfiler& profiler;
+    FrameSection section;
+    bool active;
+    std::chrono::steady_clock::time_point start;
+
+public:
+    ScopedTimer(FrameProfiler& owner, FrameSection timed)
+        : profiler(owner), section(timed), active(owner.isEnabled()) {
+        if (active) start = std::chrono::steady_clock::now();
+    }
+
+    ~ScopedTimer() {
+        if (active) {
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            profiler.add(section, std::chrono::duration<double, std::milli>(elapsed).count());
+        }
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+};
@@ -1,70 +1,292 @@
 #include "Game.h"
+#include "ResourceManager.h"
 #include <iostream>
 #include <algorithm>
 #include <cmath>
-#include <cstdlib>
-#include <ctime>
-#include <fstream>
 #include <cstdio>
+#include <chrono>
+#include <sstream>
 const std::string HIGH_SCORE_FILE = "highscores.txt";
 
-Game::Game() : window(sf::VideoMode(Constants::WINDOW_WIDTH, Constants::WINDOW_HEIGHT), "Tank Battle - Modular Edition"),
-currentState(GameState::MENU), score(0), level(1), selectedOption(0) {
+Game::Game(unsigned worldWidth, unsigned worldHeight)
+    : window(sf::VideoMode(Constants::WINDOW_WIDTH, Constants::WINDOW_HEIGHT), "Tank Battle - Modular Edition"),
+font(nullptr), currentState(GameState::MENU), world(worldWidth, worldHeight),
+tickRate(Constants::TICK_RATE), tickDuration(1.0f / Constants::TICK_RATE), maxCatchUpSteps(Constants::MAX_CATCH_UP_STEPS),
+accumulator(0.0f), renderAlpha(1.0f), selectedOption(0), hasFixedSeed(false), fixedSeed(0),
+highScoreStorage(HIGH_SCORE_FILE) {
 
-    window.setFramerateLimit(60);
-    std::srand(static_cast<unsigned>(std::time(nullptr)));
+    window.setFramerateLimit(Constants::FRAMERATE_LIMIT);
+    window.setVerticalSyncEnabled(Constants::VSYNC_ENABLED);
 
-    if (!shootBuffer.loadFromFile("audio/shoot.wav"))
-        std::cerr << "Failed to load shoot.wav\n";
-    if (!hitBuffer.loadFromFile("audio/hit.wav"))
-        std::cerr << "Failed to load hit.wav\n";
+    preloadResources();
+
+    if (const sf::SoundBuffer* shootBuffer = ResourceManager::instance().getSoundBuffer("audio/shoot.wav"))
+        shootSound.setBuffer(*shootBuffer);
+    if (const sf::SoundBuffer* hitBuffer = ResourceManager::instance().getSoundBuffer("audio/hit.wav"))
+        hitSound.setBuffer(*hitBuffer);
     if (!bgMusic.openFromFile("audio/bg.wav"))
         std::cerr << "Failed to load bg.wav\n";
 
-    shootSound.setBuffer(shootBuffer);
-    hitSound.setBuffer(hitBuffer);
     bgMusic.setLoop(true);
     bgMusic.play();
 
     initializeFont();
     setupUI();
     setupBackground();
-    setupLevel();
+    blockRenderer.load();
+    camera.setLimits(world.getBounds());
+    world.reset(Random::makeSeed());
 
-    enemySpawnInterval = Constants::ENEMY_SPAWN_INTERVAL;
+    highScores = highScoreStorage.load();
+}
 
-    highScores = loadHighScores();
+Game::~Game() {
+    const ResourceManager::Stats& stats = ResourceManager::instance().getStats();
+    std::cout << "Resources: " << stats.loads << " loads, " << stats.hits << " cache hits, "
+        << stats.failures << " failures\n";
+    ResourceManager::instance().clear();
 }
 
 void Game::run() {
+    if (fastForwardEvery > 0 && inputSource) {
+        runFastForward();
+    }
+
     while (window.isOpen()) {
-        float deltaTime = gameTimer.restart().asSeconds();
+        float frameTime = gameTimer.restart().asSeconds();
 
-        handleEvents();
+        {
+            ScopedTimer timer(profiler, SECTION_EVENTS);
+            handleEvents();
+            reloadTuning();
+        }
 
         if (currentState == GameState::PLAYING && !showLevelNotification) {
-            update(deltaTime);
+            ScopedTimer timer(profiler, SECTION_UPDATE);
+            // A long hitch is clamped to the catch-up budget instead of
+            // turning into one huge step
+            accumulator += std::min(frameTime, tickDuration * maxCatchUpSteps);
+
+            unsigned steps = 0;
+            while (accumulator >= tickDuration && steps < maxCatchUpSteps &&
+                currentState == GameState::PLAYING && !showLevelNotification) {
+                update(tickDuration);
+                accumulator -= tickDuration;
+                steps++;
+            }
+            renderAlpha = std::min(1.0f, accumulator / tickDuration);
         }
 
         if (showLevelNotification && levelNotificationTimer.getElapsedTime().asSeconds() >= levelNotificationDuration) {
             showLevelNotification = false;
-            if (level <= 5)
-                setupLevel();
+            if (world.getLevel() <= 5)
+                world.setupLevel();
         }
 
         render();
+        profiler.endFrame(world);
     }
+    finishRecording();
+    highScoreStorage.flush();
     std::remove(HIGH_SCORE_FILE.c_str());
 }
 
+void Game::preloadResources() {
+    ResourceManager& resources = ResourceManager::instance();
+    resources.buildAtlas({
+        "assets/Tank.png",
+        "assets/EnemyTank.png",
+        "assets/bullet.png",
+        "assets/tree.png",
+        "assets/oil.png",
+        "assets/wall.png",
+        "assets/dirt.png"
+    });
+    resources.preloadSoundBuffers({ "audio/shoot.wav", "audio/hit.wav" });
+}
+
+void Game::setTickRate(unsigned ticksPerSecond) {
+    if (ticksPerSecond > 0) {
+        tickRate = ticksPerSecond;
+        tickDuration = 1.0f / static_cast<float>(ticksPerSecond);
+    }
+}
+
+void Game::setMaxCatchUpSteps(unsigned steps) {
+    maxCatchUpSteps = std::max(1u, steps);
+}
+
+void Game::setSeed(std::uint64_t seed) {
+    hasFixedSeed = true;
+    fixedSeed = seed;
+}
+
+void Game::setRecordPath(const std::string& path) {
+    recordPath = path;
+}
+
+void Game::startReplay(const Replay& replay) {
+    playback = replay;
+    setTickRate(playback.getTickRate());
+    world.setTuning(playback.getTuning());
+    inputSource = std::make_unique<ReplayInput>(playback);
+    startGame();
+}
+
+void Game::setBot(std::unique_ptr<BotController> controller) {
+    bot = std::move(controller);
+    startGame();
+}
+
+void Game::setFastForward(unsigned renderEveryTicks) {
+    fastForwardEvery = renderEveryTicks;
+}
+
+void Game::runFastForward() {
+    using Clock = std::chrono::steady_clock;
+
+    window.setFramerateLimit(0);
+    window.setVerticalSyncEnabled(false);
+    bgMusic.pause();
+    audioEnabled = false;
+    world.setProfiling(true);
+    world.resetProfile();
+
+    long ticks = 0;
+    long frames = 0;
+    double renderSeconds = 0.0;
+    auto start = Clock::now();
+
+    while (window.isOpen() && currentState == GameState::PLAYING) {
+        sf::Event event;
+        while (window.pollEvent(event)) {
+            if (event.type == sf::Event::Closed ||
+                (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape)) {
+                window.close();
+            }
+        }
+
+        // Level breaks are real-time pauses between ticks, so they are skipped
+        if (showLevelNotification) {
+            showLevelNotification = false;
+            world.setupLevel();
+        }
+
+        update(tickDuration);
+        ticks++;
+
+        if (ticks % fastForwardEvery == 0) {
+            auto renderStart = Clock::now();
+            renderAlpha = 1.0f;
+            render();
+            renderSeconds += std::chrono::duration<double>(Clock::now() - renderStart).count();
+            frames++;
+        }
+    }
+
+    double wallSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+    double ticksPerSecond = wallSeconds > 0 ? ticks / wallSeconds : 0.0;
+    std::cout << "Fast-forward: " << ticks << " ticks (" << ticks * tickDuration << " s simulated) in "
+        << wallSeconds * 1000.0 << " ms, " << ticksPerSecond << " ticks/s ("
+        << ticksPerSecond * tickDuration << "x real time)\n";
+    std::cout << "Rendering: " << frames << " frames, " << renderSeconds * 1000.0 << " ms\n";
+    std::cout << "Time per phase:\n";
+    world.writeProfile(std::cout, ticks);
+
+    world.setProfiling(profiler.isEnabled());
+    audioEnabled = true;
+    bgMusic.play();
+    window.setFramerateLimit(Constants::FRAMERATE_LIMIT);
+    window.setVerticalSyncEnabled(Constants::VSYNC_ENABLED);
+    gameTimer.restart();
+}
+
+void Game::finishRecording() {
+    if (!recordingActive) return;
+    recordingActive = false;
+
+    if (recording.save(recordPath)) {
+        std::cout << "Replay saved to " << recordPath << " (" << recording.size() << " ticks)\n";
+    }
+}
+
+bool Game::setTuningFile(const std::string& path) {
+    Tuning values;
+    if (!tuningWatcher.open(path, values)) return false;
+
+    world.setTuning(values);
+    tuningPollTimer.restart();
+    return true;
+}
+
+void Game::finishBotMatch(const char* result) {
+    const MatchStats& stats = world.getStats();
+    std::cout << "Bot match " << ++botMatches << ": " << result << ", level " << world.getLevel()
+        << ", score " << world.getScore() << ", " << stats.timeAlive << " s alive, "
+        << stats.getAccuracy() * 100.0f << "% accuracy\n";
+    // Soak runs go on unattended, so the next match starts right away. Bot
+    // scores stay out of the high score table, which would also mean a disk
+    // write per match.
+    startGame();
+}
+
+void Game::reloadTuning() {
+    // A replay only reproduces with the values it was recorded under, and a
+    // recording stores only the values it started with, so while either runs
+    // edits wait for the next match
+    if (inputSource || recordingActive || tuningPollTimer.getElapsedTime().asSeconds() < 0.25f) return;
+    tuningPollTimer.restart();
+    applyTuningChanges();
+}
+
+void Game::applyTuningChanges() {
+    if (!tuningWatcher.isWatching()) return;
+
+    Tuning values = world.getTuning();
+    if (!tuningWatcher.poll(values)) return;
+
+    world.setTuning(values);
+    std::cout << "Tuning reloaded from " << tuningWatcher.getPath() << "\n";
+}
+
+void Game::toggleProfiler() {
+    profiler.setEnabled(!profiler.isEnabled(), world);
+    // Forces a rebuild of the overlay text on the first frame
+    profilerText.setString("");
+}
+
+void Game::quickSaveWorld() {
+    world.saveSnapshot(quickSave);
+    std::cout << "Quicksave: " << quickSave.size() << " bytes\n";
+}
+
+void Game::quickLoadWorld() {
+    // A replay's remaining input no longer fits a restored world
+    if (quickSave.empty() || inputSource) return;
+
+    // Neither can a recording that jumps back in time
+    finishRecording();
+    if (!world.restoreSnapshot(quickSave)) {
+        std::cerr << "Quicksave could not be restored, restarting the match\n";
+        quickSave.clear();
+        world.reset(hasFixedSeed ? fixedSeed : Random::makeSeed());
+    }
+    pendingInput = PlayerInput();
+    accumulator = 0.0f;
+    updateCamera();
+}
+
 void Game::initializeFont() {
-    if (!font.loadFromFile("arial.ttf")) {
+    static const sf::Font fallbackFont;
+    font = ResourceManager::instance().getFont("arial.ttf");
+    if (!font) {
         std::cout << "Warning: Could not load arial.ttf, using default font\n";
+        font = &fallbackFont;
     }
 }
 
 void Game::setupUI() {
-    titleText.setFont(font);
+    titleText.setFont(*font);
     titleText.setString("TANK BATTLE");
     titleText.setCharacterSize(48);
     titleText.setFillColor(sf::Color::White);
@@ -73,13 +295,13 @@ void Game::setupUI() {
     std::vector<std::string> options = { "PLAY", "INSTRUCTIONS", "QUIT" };
     menuOptions.clear();
 
-    pauseResumeText.setFont(font);
+    pauseResumeText.setFont(*font);
     pauseResumeText.setString("Press ESC to resume");
     pauseResumeText.setCharacterSize(20);
     pauseResumeText.setFillColor(sf::Color::Yellow);
     centerText(pauseResumeText, static_cast<float>(Constants::WINDOW_WIDTH) / 2.0f, static_cast<float>(Constants::WINDOW_HEIGHT) / 2.0f + 60);
 
-    pauseMenuText.setFont(font);
+    pauseMenuText.setFont(*font);
     pauseMenuText.setString("Go back to menu");
     pauseMenuText.setCharacterSize(20);
     pauseMenuText.setFillColor(sf::Color::White);
@@ -87,7 +309,7 @@ void Game::setupUI() {
 
     for (size_t i = 0; i < options.size(); ++i) {
         sf::Text optionText;
-        optionText.setFont(font);
+        optionText.setFont(*font);
         optionText.setString(options[i]);
         optionText.setCharacterSize(32);
         optionText.setFillColor(sf::Color::White);
@@ -101,6 +323,7 @@ void Game::setupUI() {
         "WASD - Move tank",
         "Mouse - Aim and shoot",
         "ESC - Pause game",
+        "F3 - Performance overlay",
         "",
         "OBJECTIVE:",
         "Destroy enemy tanks",
@@ -113,7 +336,7 @@ void Game::setupUI() {
     instructionTexts.clear();
     for (size_t i = 0; i < instructions.size(); ++i) {
         sf::Text instrText;
-        instrText.setFont(font);
+        instrText.setFont(*font);
         instrText.setString(instructions[i]);
         instrText.setCharacterSize(20);
         instrText.setFillColor(sf::Color::White);
@@ -122,12 +345,19 @@ void Game::setupUI() {
         instructionTexts.push_back(instrText);
     }
 
-    scoreText.setFont(font);
+    scoreText.setFont(*font);
     scoreText.setCharacterSize(20);
     scoreText.setFillColor(sf::Color::White);
     scoreText.setPosition(10, 10);
 
-    gameOverText.setFont(font);
+    profilerText.setFont(*font);
+    profilerText.setCharacterSize(12);
+    profilerText.setFillColor(sf::Color::White);
+    profilerText.setPosition(15, 75);
+    profilerBackground.setFillColor(sf::Color(0, 0, 0, 170));
+    profilerBackground.setPosition(10, 70);
+
+    gameOverText.setFont(*font);
     gameOverText.setString("GAME OVER");
     gameOverText.setCharacterSize(48);
     gameOverText.setFillColor(sf::Color::Red);
@@ -155,76 +385,15 @@ void Game::setupBackground() {
     }
 }
 
-void Game::setupLevel() {
-    levelBlocks.clear();
-    createLevelBlocks();
-
-    player = std::make_unique<PlayerTank>(sf::Vector2f(100, 100), &bullets);
-
-    float scale = 1.0f + (level - 1) * 0.5f;
-    player->setScale(scale, scale);
-
-    float enemySpeed = Constants::ENEMY_SPEED;
-    if (level >= 5) {
-        enemySpeed += 40.0f;
-    }
-    else if (level >= 3) {
-        enemySpeed += 20.0f;
-    }
-    for (auto& enemy : enemies) {
-        enemy->setSpeed(enemySpeed);
-        if (level >= 5) {
-            enemySpeed += 20.0f;
-            enemy->setAttackCooldown(Constants::ENEMY_ATTACK_COOLDOWN * 0.7f);
-        }
-    }
-
-    enemies.clear();
-    bullets.clear();
-
-    enemiesToDefeat = 5 + (level - 1) * 2;
-    enemiesDefeated = 0;
-
-    enemySpawnTimer.restart();
-}
-
-
-
-void Game::createLevelBlocks() {
-    // No wall boundaries - open world with sand background
-
-    for (int i = 0; i < 10; ++i) {
-        float x = 100 + static_cast<float>(rand() % (Constants::WINDOW_WIDTH - 200));
-        float y = 100 + static_cast<float>(rand() % (Constants::WINDOW_HEIGHT - 200));
-        levelBlocks.push_back(std::make_unique<Block>(sf::Vector2f(x, y), BlockType::DESTRUCTIBLE));
-    }
-    for (int i = 0; i < 10; ++i) {
-        float x = 100 + static_cast<float>(rand() % (Constants::WINDOW_WIDTH - 200));
-        float y = 100 + static_cast<float>(rand() % (Constants::WINDOW_HEIGHT - 200));
-        levelBlocks.push_back(std::make_unique<Block>(sf::Vector2f(x, y), BlockType::DESTRUCTIBLE));
-    }
-    // Some strategic tree blocks for cover
-    levelBlocks.push_back(std::make_unique<Block>(sf::Vector2f(280, 240), BlockType::DESTRUCTIBLE));
-    levelBlocks.push_back(std::make_unique<Block>(sf::Vector2f(320, 200), BlockType::DESTRUCTIBLE));
-    levelBlocks.push_back(std::make_unique<Block>(sf::Vector2f(440, 400), BlockType::DESTRUCTIBLE));
-    levelBlocks.push_back(std::make_unique<Block>(sf::Vector2f(400, 440), BlockType::DESTRUCTIBLE));
-
-    // Add some indestructible wall blocks for strategic gameplay
-    levelBlocks.push_back(std::make_unique<Block>(sf::Vector2f(200, 200), BlockType::WALL_INDESTRUCTIBLE));
-    levelBlocks.push_back(std::make_unique<Block>(sf::Vector2f(240, 200), BlockType::WALL_INDESTRUCTIBLE));
-    levelBlocks.push_back(std::make_unique<Block>(sf::Vector2f(600, 400), BlockType::WALL_INDESTRUCTIBLE));
-    levelBlocks.push_back(std::make_unique<Block>(sf::Vector2f(640, 400), BlockType::WALL_INDESTRUCTIBLE));
-
-    levelBlocks.push_back(std::make_unique<Block>(sf::Vector2f(400, 300), BlockType::WATER));
-    levelBlocks.push_back(std::make_unique<Block>(sf::Vector2f(440, 300), BlockType::WATER));
-}
-
 void Game::handleEvents() {
     sf::Event event;
     while (window.pollEvent(event)) {
         if (event.type == sf::Event::Closed) {
             window.close();
         }
+        else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3) {
+            toggleProfiler();
+        }
 
         handleStateSpecificEvents(event);
     }
@@ -244,6 +413,12 @@ void Game::handleStateSpecificEvents(const sf::Event& event) {
         if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape) {
             currentState = GameState::PAUSED;
         }
+        else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F5) {
+            quickSaveWorld();
+        }
+        else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F9) {
+            quickLoadWorld();
+        }
         break;
 
     case GameState::PAUSED:
@@ -256,6 +431,7 @@ void Game::handleStateSpecificEvents(const sf::Event& event) {
                 currentState = GameState::PLAYING;
             }
             else if (pauseMenuText.getGlobalBounds().contains(mousePos)) {
+                finishRecording();
                 currentState = GameState::MENU;
             }
         }
@@ -281,11 +457,7 @@ void Game::handleStateSpecificEvents(const sf::Event& event) {
             restartGame();
         }
         else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape) {
-            std::vector<int> scores = loadHighScores();
-            scores.push_back(score);
-            std::sort(scores.rbegin(), scores.rend());
-            if (scores.size() > 10) scores.resize(10);
-            saveHighScores(scores);
+            recordScore(world.getScore());
 
             currentState = GameState::MENU;
         }
@@ -349,31 +521,26 @@ void Game::executeMenuOption() {
 }
 
 void Game::handleGameplayInput() {
-    if (showLevelNotification) return;
+    if (showLevelNotification || inputSource || bot) return;
 
+    const PlayerTank* player = world.getPlayer();
     if (!player || player->isDestroyed()) return;
 
-    sf::Vector2f movement(0, 0);
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::W)) movement.y -= 1;
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::S)) movement.y += 1;
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::A)) movement.x -= 1;
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::D)) movement.x += 1;
-
-    player->move(movement.x, movement.y);
+    pendingInput.release(PlayerInput::MOVE_UP);
+    pendingInput.release(PlayerInput::MOVE_DOWN);
+    pendingInput.release(PlayerInput::MOVE_LEFT);
+    pendingInput.release(PlayerInput::MOVE_RIGHT);
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::W)) pendingInput.press(PlayerInput::MOVE_UP);
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::S)) pendingInput.press(PlayerInput::MOVE_DOWN);
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::A)) pendingInput.press(PlayerInput::MOVE_LEFT);
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::D)) pendingInput.press(PlayerInput::MOVE_RIGHT);
 
-    sf::Vector2f mousePos = window.mapPixelToCoords(sf::Mouse::getPosition(window));
-    sf::Vector2f playerPos = player->getCenter();
-    sf::Vector2f direction = mousePos - playerPos;
-
-    if (direction.x != 0 || direction.y != 0) {
-        float angle = atan2(direction.y, direction.x) * 180.0f / static_cast<float>(M_PI);
-        player->setRotation(angle);
-    }
+    sf::Vector2f mousePos = window.mapPixelToCoords(sf::Mouse::getPosition(window), camera.getView());
+    pendingInput.setAim(mousePos - player->getCenter());
 
     bool mouseLeftNow = sf::Mouse::isButtonPressed(sf::Mouse::Left);
     if (mouseLeftNow && !mouseLeftPreviouslyPressed) {
-        shootSound.play();
-        player->attack(mousePos);
+        pendingInput.press(PlayerInput::FIRE);
     }
     mouseLeftPreviouslyPressed = mouseLeftNow;
 }
@@ -381,236 +548,125 @@ void Game::handleGameplayInput() {
 void Game::startGame() {
     mouseLeftPreviouslyPressed = true;
     currentState = GameState::PLAYING;
-    score = 0;
-    level = 1;
     gameOverText.setString("GAME OVER");
     centerText(gameOverText, static_cast<float>(Constants::WINDOW_WIDTH) / 2.0f,
         static_cast<float>(Constants::WINDOW_HEIGHT) / 2.0f);
-    setupLevel();
-    gameTimer.restart();
-}
+    finishRecording();
+    pendingInput = PlayerInput();
 
-void Game::restartGame() {
-    std::vector<int> scores = loadHighScores();
-    scores.push_back(score);
-    std::sort(scores.rbegin(), scores.rend());
-    if (scores.size() > 10) scores.resize(10);
-    saveHighScores(scores);
-    startGame();
-}
-
-void Game::update(float deltaTime) {
-    if (player && !player->isDestroyed()) {
-        player->update(deltaTime);
-        player->updateMovement(deltaTime, levelBlocks);
-    }
-
-    for (auto& enemy : enemies) {
-        if (enemy && !enemy->isDestroyed()) {
-            enemy->update(deltaTime);
-            enemy->updateMovement(deltaTime, levelBlocks);
-        }
+    std::uint64_t seed = hasFixedSeed ? fixedSeed : Random::makeSeed();
+    if (inputSource) {
+        inputSource->restart();
+        seed = playback.getSeed();
     }
-
-    for (auto& bullet : bullets) {
-        if (bullet && !bullet->isDestroyed()) {
-            bullet->update(deltaTime);
-        }
-    }
-
-    for (auto& block : levelBlocks) {
-        if (block && !block->isDestroyed()) {
-            block->update(deltaTime);
+    else {
+        // Picks up edits held back while the previous match was recorded
+        applyTuningChanges();
+        if (bot) {
+            bot->restart();
         }
     }
+    world.reset(seed);
 
-    spawnEnemies();
-
-    checkCollisions();
-
-    cleanupObjects();
-
-    if (player && player->isDestroyed()) {
-        currentState = GameState::GAMEOVER;
-    }
-
-    if (enemiesDefeated >= enemiesToDefeat) {
-        nextLevel();
+    if (!recordPath.empty() && !inputSource) {
+        const sf::FloatRect& bounds = world.getBounds();
+        recording.begin(seed, tickRate, static_cast<unsigned>(bounds.width), static_cast<unsigned>(bounds.height),
+            world.getTuning());
+        recordingActive = true;
     }
+    accumulator = 0.0f;
+    renderAlpha = 1.0f;
+    gameTimer.restart();
 }
 
-void Game::spawnEnemies() {
-    if (enemySpawnTimer.getElapsedTime().asSeconds() >= enemySpawnInterval) {
-        if (enemies.size() < 3 && (enemiesDefeated + enemies.size()) < enemiesToDefeat) {
-            sf::Vector2f spawnPos = getRandomSpawnPosition();
-            auto enemy = std::make_unique<EnemyTank>(spawnPos, player.get(), &bullets);
-            enemies.push_back(std::move(enemy));
-        }
-        enemySpawnTimer.restart();
-    }
+void Game::restartGame() {
+    recordScore(world.getScore());
+    startGame();
 }
 
-sf::Vector2f Game::getRandomSpawnPosition() {
-    sf::Vector2f pos;
-    bool validPosition = false;
-    int attempts = 0;
-
-    while (!validPosition && attempts < 100) {
-        pos.x = 50 + static_cast<float>(rand() % (Constants::WINDOW_WIDTH - 100));
-        pos.y = 50 + static_cast<float>(rand() % (Constants::WINDOW_HEIGHT - 100));
+void Game::recordScore(int score) {
+    // A replayed run already scored when it was played
+    if (inputSource) return;
 
-        validPosition = true;
-
-        if (player) {
-            sf::Vector2f playerPos = player->getCenter();
-            float distance = sqrt(pow(pos.x - playerPos.x, 2) + pow(pos.y - playerPos.y, 2));
-            if (distance < 200.0f) {
-                validPosition = false;
-            }
-        }
-
-        sf::FloatRect spawnArea(pos.x - 20, pos.y - 20, 40, 40);
-        for (const auto& block : levelBlocks) {
-            if (block && !block->isDestroyed() && block->isBlocking()) {
-                if (spawnArea.intersects(block->getBounds())) {
-                    validPosition = false;
-                    break;
-                }
-            }
-        }
-
-        attempts++;
-    }
-
-    return pos;
+    highScores.push_back(score);
+    std::sort(highScores.rbegin(), highScores.rend());
+    if (highScores.size() > 10) highScores.resize(10);
+    highScoreStorage.saveAsync(highScores);
 }
 
-void Game::checkCollisions() {
-    for (auto& bullet : bullets) {
-        if (!bullet || bullet->isDestroyed()) continue;
-
-        for (auto& block : levelBlocks) {
-            if (!block || block->isDestroyed()) continue;
-
-            if (bullet->getBounds().intersects(block->getBounds())) {
-                if (block->isBlocking()) {
-                    block->takeDamage(bullet->getDamage());
-                    bullet->destroy();
-
-                    if (block->isDestroyed()) {
-                        score += 5;
-                    }
-                    break;
-                }
-            }
+void Game::update(float deltaTime) {
+    PlayerInput input = pendingInput;
+    if (inputSource) {
+        if (inputSource->isFinished()) {
+            gameOverText.setString("REPLAY ENDED");
+            centerText(gameOverText, static_cast<float>(Constants::WINDOW_WIDTH) / 2.0f,
+                static_cast<float>(Constants::WINDOW_HEIGHT) / 2.0f);
+            currentState = GameState::GAMEOVER;
+            return;
         }
+        input = inputSource->nextInput(world);
     }
-
-    for (auto& bullet : bullets) {
-        if (!bullet || bullet->isDestroyed()) continue;
-
-        if (bullet->isFromPlayer()) {
-            for (auto& enemy : enemies) {
-                if (!enemy || enemy->isDestroyed()) continue;
-
-                if (bullet->getBounds().intersects(enemy->getBounds())) {
-                    enemy->takeDamage(bullet->getDamage());
-                    bullet->destroy();
-
-                    if (enemy->isDestroyed()) {
-                        score += 100;
-                        enemiesDefeated++;
-                    }
-                    break;
-                }
-            }
-        }
-        else {
-            if (player && !player->isDestroyed()) {
-                if (bullet->getBounds().intersects(player->getBounds())) {
-                    player->takeDamage(bullet->getDamage());
-                    bullet->destroy();
-                    break;
-                }
-            }
-        }
+    else if (bot) {
+        input = bot->nextInput(world);
     }
-
-    if (player && !player->isDestroyed()) {
-        for (auto& enemy : enemies) {
-            if (!enemy || enemy->isDestroyed()) continue;
-
-            if (player->getBounds().intersects(enemy->getBounds())) {
-                sf::Vector2f separation = player->getCenter() - enemy->getCenter();
-                float distance = sqrt(separation.x * separation.x + separation.y * separation.y);
-                if (distance > 0) {
-                    separation /= distance;
-                    separation *= 2.0f;
-
-                    sf::Vector2f playerPos = player->getCenter() + separation;
-                    sf::Vector2f enemyPos = enemy->getCenter() - separation;
-
-                    playerPos.x = std::max(20.0f, std::min(780.0f, playerPos.x));
-                    playerPos.y = std::max(20.0f, std::min(580.0f, playerPos.y));
-                    enemyPos.x = std::max(20.0f, std::min(780.0f, enemyPos.x));
-                    enemyPos.y = std::max(20.0f, std::min(580.0f, enemyPos.y));
-
-                    player->setPosition(playerPos);
-                    enemy->setPosition(enemyPos);
-                }
-            }
-        }
+    else {
+        pendingInput.release(PlayerInput::FIRE);
     }
-}
-
-void Game::cleanupObjects() {
-    bullets.erase(
-        std::remove_if(bullets.begin(), bullets.end(),
-            [](const std::unique_ptr<Bullet>& bullet) {
-                return !bullet || bullet->isDestroyed();
-            }),
-        bullets.end()
-    );
 
-    enemies.erase(
-        std::remove_if(enemies.begin(), enemies.end(),
-            [](const std::unique_ptr<EnemyTank>& enemy) {
-                return !enemy || enemy->isDestroyed();
-            }),
-        enemies.end()
-    );
+    if (recordingActive) {
+        recording.append(input);
+    }
 
-    levelBlocks.erase(
-        std::remove_if(levelBlocks.begin(), levelBlocks.end(),
-            [](const std::unique_ptr<Block>& block) {
-                return !block || block->isDestroyed();
-            }),
-        levelBlocks.end()
-    );
-}
+    // Bots hold FIRE through the cooldown, so only a shot the World actually
+    // fired plays the sound
+    unsigned shotsBefore = world.getStats().shotsFired;
+    world.applyInput(input);
+    world.update(deltaTime);
+    if (audioEnabled && world.getStats().shotsFired > shotsBefore) {
+        shootSound.play();
+    }
 
-void Game::nextLevel() {
-    level++;
-    score += 500;
+    switch (world.getStatus()) {
+    case WorldStatus::GAME_OVER:
+        finishRecording();
+        if (bot) {
+            finishBotMatch("defeated");
+            break;
+        }
+        currentState = GameState::GAMEOVER;
+        break;
 
-    if (level > 5) {
-        level--;
+    case WorldStatus::VICTORY:
+        finishRecording();
+        if (bot) {
+            finishBotMatch("victory");
+            break;
+        }
         showLevelNotification = false;
         gameOverText.setString("YOU WIN!");
         centerText(gameOverText, static_cast<float>(Constants::WINDOW_WIDTH) / 2.0f,
             static_cast<float>(Constants::WINDOW_HEIGHT) / 2.0f);
         currentState = GameState::GAMEOVER;
-        return;
+        break;
+
+    case WorldStatus::LEVEL_CLEARED:
+        nextLevel();
+        break;
+
+    default:
+        break;
     }
+}
 
-    enemySpawnInterval = std::max(1.0f, enemySpawnInterval - 0.2f);
+void Game::nextLevel() {
+    int level = world.getLevel();
 
     showLevelNotification = true;
-    levelNotificationText.setFont(font);
+    levelNotificationText.setFont(*font);
     levelNotificationText.setCharacterSize(50);
     levelNotificationText.setFillColor(sf::Color::Red);
 
-    levelHintText.setFont(font);
+    levelHintText.setFont(*font);
     levelHintText.setCharacterSize(24);
     levelHintText.setFillColor(sf::Color::Yellow);
     if (level == 2) {
@@ -637,47 +693,74 @@ void Game::nextLevel() {
     levelNotificationTimer.restart();
 }
 
-void Game::render() {
-    window.clear(sf::Color::Black);
+void Game::updateCamera() {
+    const PlayerTank* player = world.getPlayer();
+    if (player && !player->isDestroyed()) {
+        camera.follow(player->getInterpolatedPosition(renderAlpha));
+    }
+}
 
-    switch (currentState) {
-    case GameState::MENU:
-        renderMenu();
-        break;
+bool Game::isVisible(const sf::FloatRect& bounds) const {
+    // Health bars sit above the tank, so the view is padded a little
+    sf::FloatRect area = camera.getVisibleArea();
+    area.left -= 40.0f;
+    area.top -= 40.0f;
+    area.width += 80.0f;
+    area.height += 80.0f;
+    return area.intersects(bounds);
+}
 
-    case GameState::PLAYING:
-        renderBackground();
-        renderGame();
-        if (showLevelNotification) {
-            window.draw(levelNotificationText);
-            if (!levelHintText.getString().isEmpty())
-                window.draw(levelHintText);
-        }
-        break;
+void Game::render() {
+    {
+        ScopedTimer timer(profiler, SECTION_RENDER);
+        window.clear(sf::Color::Black);
+        updateCamera();
+
+        switch (currentState) {
+        case GameState::MENU:
+            renderMenu();
+            break;
+
+        case GameState::PLAYING:
+            renderBackground();
+            renderGame();
+            if (showLevelNotification) {
+                window.draw(levelNotificationText);
+                if (!levelHintText.getString().isEmpty())
+                    window.draw(levelHintText);
+            }
+            break;
 
-    case GameState::PAUSED:
-        renderBackground();
-        renderGame();
-        renderPause();
-        break;
+        case GameState::PAUSED:
+            renderBackground();
+            renderGame();
+            renderPause();
+            break;
 
-    case GameState::GAMEOVER:
-        renderBackground();
-        renderGame();
-        renderGameOver();
-        break;
+        case GameState::GAMEOVER:
+            renderBackground();
+            renderGame();
+            renderGameOver();
+            break;
 
-    case GameState::INSTRUCTIONS:
-        renderInstructions();
-        break;
+        case GameState::INSTRUCTIONS:
+            renderInstructions();
+            break;
+        }
+
+        if (profiler.isEnabled()) {
+            renderProfiler();
+        }
     }
 
+    // Waiting for vsync or the frame limiter lands here, not in render
+    ScopedTimer presentTimer(profiler, SECTION_PRESENT);
     window.display();
 }
 
 void Game::renderBackground() {
     if (background) {
-        background->draw(window);
+        background->draw(batch, camera.getVisibleArea());
     }
 }
 
@@ -695,17 +778,17 @@ void Game::renderMenu() {
     }
 
     sf::Text historyTitle;
-    historyTitle.setFont(font);
+    historyTitle.setFont(*font);
     historyTitle.setString("HIGH SCORES:");
     historyTitle.setCharacterSize(24);
     historyTitle.setFillColor(sf::Color::Cyan);
     centerText(historyTitle, static_cast<float>(Constants::WINDOW_WIDTH) / 2.0f, 450.0f);
     window.draw(historyTitle);
 
-    std::vector<int> scores = loadHighScores();
+    const std::vector<int>& scores = highScores;
     for (size_t i = 0; i < std::min(scores.size(), size_t(5)); ++i) {
         sf::Text scoreEntry;
-        scoreEntry.setFont(font);
+        scoreEntry.setFont(*font);
         scoreEntry.setString(std::to_string(i + 1) + ". " + std::to_string(scores[i]));
         scoreEntry.setCharacterSize(18);
         scoreEntry.setFillColor(sf::Color::White);
@@ -715,34 +798,49 @@ void Game::renderMenu() {
 }
 
 void Game::renderGame() {
-    for (const auto& block : levelBlocks) {
-        if (block && !block->isDestroyed()) {
-            block->draw(window);
-        }
-    }
+    // Only what intersects the camera is submitted, so the cost follows the
+    // window size rather than the map size
+    sf::FloatRect visibleArea = camera.getVisibleArea();
+    blockRenderer.drawTilemap(world.getTilemap(), visibleArea, batch);
+    blockRenderer.draw(world.getBlockGrid(), visibleArea, batch);
 
-    if (player && !player->isDestroyed()) {
-        player->draw(window);
+    PlayerTank* player = world.getPlayer();
+    if (player && !player->isDestroyed() && isVisible(player->getBounds())) {
+        player->draw(batch, renderAlpha);
     }
 
-    for (const auto& enemy : enemies) {
-        if (enemy && !enemy->isDestroyed()) {
-            enemy->draw(window);
+    for (const auto& enemy : world.getEnemies()) {
+        if (enemy && !enemy->isDestroyed() && isVisible(enemy->getBounds())) {
+            enemy->draw(batch, renderAlpha);
         }
     }
 
-    for (const auto& bullet : bullets) {
-        if (bullet && !bullet->isDestroyed()) {
-            bullet->draw(window);
+    // Bullets are plain records; one shape is restyled and submitted for each
+    const BulletPool& bullets = world.getBullets();
+    for (size_t i = 0; i < bullets.size(); ++i) {
+        if (!bullets.isAlive(i) || !isVisible(bullets.getBounds(i))) continue;
+
+        float radius = bullets.getRadius(i);
+        if (bulletShape.getRadius() != radius) {
+            bulletShape.setRadius(radius);
+            bulletShape.setOrigin(radius, radius);
         }
+        bulletShape.setFillColor(bullets.isFromPlayer(i) ? sf::Color::Yellow : sf::Color::Cyan);
+        bulletShape.setPosition(bullets.getInterpolatedPosition(i, renderAlpha));
+        batch.draw(bulletShape, LAYER_BULLETS);
     }
+
+    window.setView(camera.getView());
+    batch.flush(window);
+    window.setView(window.getDefaultView());
     renderGameUI();
 }
 
 void Game::renderGameUI() {
-    scoreText.setString("Score: " + std::to_string(score) + "  Level: " + std::to_string(level));
+    scoreText.setString("Score: " + std::to_string(world.getScore()) + "  Level: " + std::to_string(world.getLevel()));
     window.draw(scoreText);
 
+    const PlayerTank* player = world.getPlayer();
     if (player && !player->isDestroyed()) {
         sf::RectangleShape healthBg;
         healthBg.setSize(sf::Vector2f(210.0f, 40.0f));
@@ -758,7 +856,7 @@ void Game::renderGameUI() {
         window.draw(healthBar);
 
         sf::Text healthText;
-        healthText.setFont(font);
+        healthText.setFont(*font);
         healthText.setString("Health: " + std::to_string(static_cast<int>(player->getHealth())));
         healthText.setCharacterSize(16);
         healthText.setFillColor(sf::Color::White);
@@ -767,12 +865,56 @@ void Game::renderGameUI() {
     }
 
     sf::Text enemiesLeftText;
-    enemiesLeftText.setFont(font);
-    enemiesLeftText.setString("Enemies Left: " + std::to_string(enemiesToDefeat - enemiesDefeated));
+    enemiesLeftText.setFont(*font);
+    enemiesLeftText.setString("Enemies Left: " + std::to_string(world.getEnemiesRemaining()));
     enemiesLeftText.setCharacterSize(16);
     enemiesLeftText.setFillColor(sf::Color::White);
     enemiesLeftText.setPosition(40, 40);
     window.draw(enemiesLeftText);
+
+    sf::Text drawCallsText;
+    drawCallsText.setFont(*font);
+    drawCallsText.setString("Seed: " + std::to_string(world.getSeed()) +
+        "  Draw calls: " + std::to_string(batch.getDrawCalls()));
+    drawCallsText.setCharacterSize(12);
+    drawCallsText.setFillColor(sf::Color(200, 200, 200));
+    drawCallsText.setPosition(10, static_cast<float>(Constants::WINDOW_HEIGHT) - 20);
+    window.draw(drawCallsText);
+}
+
+void Game::renderProfiler() {
+    if (profilerText.getString().isEmpty() || profilerRefreshTimer.getElapsedTime().asSeconds() >= 0.25f) {
+        profilerRefreshTimer.restart();
+
+        size_t enemies = 0;
+        for (const auto& enemy : world.getEnemies()) {
+            if (!enemy->isDestroyed()) enemies++;
+        }
+        const BulletPool& bullets = world.getBullets();
+        size_t liveBullets = 0;
+        for (size_t i = 0; i < bullets.size(); ++i) {
+            if (bullets.isAlive(i)) liveBullets++;
+        }
+        size_t blocks = 0;
+        for (const Block& block : world.getBlocks()) {
+            if (!block.isDestroyed()) blocks++;
+        }
+
+        std::ostringstream report;
+        profiler.writeReport(report);
+        report << "enemies " << enemies << "  bullets " << liveBullets << "/" << bullets.getCapacity()
+            << "  blocks " << blocks << "\n";
+        report << "batched draw calls " << batch.getDrawCalls() << "  (last "
+            << profiler.getSection(SECTION_FRAME).getCount() << " frames)";
+        profilerText.setString(report.str());
+
+        sf::FloatRect bounds = profilerText.getLocalBounds();
+        profilerBackground.setSize(sf::Vector2f(bounds.left + bounds.width + 10, bounds.top + bounds.height + 10));
+    }
+
+    window.setView(window.getDefaultView());
+    window.draw(profilerBackground);
+    window.draw(profilerText);
 }
 
 void Game::renderPause() {
@@ -782,7 +924,7 @@ void Game::renderPause() {
     window.draw(overlay);
 
     sf::Text pauseText;
-    pauseText.setFont(font);
+    pauseText.setFont(*font);
     pauseText.setString("PAUSED");
     pauseText.setCharacterSize(48);
     pauseText.setFillColor(sf::Color::White);
@@ -797,23 +939,23 @@ void Game::renderGameOver() {
     window.draw(gameOverText);
 
     sf::Text finalScoreText;
-    finalScoreText.setFont(font);
-    finalScoreText.setString("Final Score: " + std::to_string(score));
+    finalScoreText.setFont(*font);
+    finalScoreText.setString("Final Score: " + std::to_string(world.getScore()));
     finalScoreText.setCharacterSize(32);
     finalScoreText.setFillColor(sf::Color::Yellow);
     centerText(finalScoreText, static_cast<float>(Constants::WINDOW_WIDTH) / 2.0f, static_cast<float>(Constants::WINDOW_HEIGHT) / 2.0f + 60);
     window.draw(finalScoreText);
 
     sf::Text levelText;
-    levelText.setFont(font);
-    levelText.setString("Level Reached: " + std::to_string(level));
+    levelText.setFont(*font);
+    levelText.setString("Level Reached: " + std::to_string(world.getLevel()));
     levelText.setCharacterSize(24);
     levelText.setFillColor(sf::Color::Cyan);
     centerText(levelText, static_cast<float>(Constants::WINDOW_WIDTH) / 2.0f, static_cast<float>(Constants::WINDOW_HEIGHT) / 2.0f + 100);
     window.draw(levelText);
 
     sf::Text restartText;
-    restartText.setFont(font);
+    restartText.setFont(*font);
     restartText.setString("Press SPACE to restart or ESC for menu");
     restartText.setCharacterSize(18);
     restartText.setFillColor(sf::Color::White);
@@ -826,20 +968,3 @@ void Game::renderInstructions() {
         window.draw(text);
     }
 }
-
-std::vector<int> Game::loadHighScores() {
-    std::vector<int> scores;
-    std::ifstream in(HIGH_SCORE_FILE);
-    int s;
-    while (in >> s) {
-        scores.push_back(s);
-    }
-    std::sort(scores.rbegin(), scores.rend());
-    if (scores.size() > 10) scores.resize(10);
-    return scores;
-}
-
-void Game::saveHighScores(const std::vector<int>& scores) {
-    std::ofstream out(HIGH_SCORE_FILE, std::ios::trunc);
-    for (int s : scores) out << s << std::endl;
-}
\ No newline at end of file
@@ -1,23 +1,29 @@
 #pragma once
 #include "Constants.h"
-#include "PlayerTank.h"
-#include "EnemyTank.h"
-#include "Bullet.h"
-#include "Block.h"
+#include "World.h"
+#include "Camera.h"
 #include "Background.h"
+#include "SpriteBatch.h"
+#include "BlockRenderer.h"
+#include "HighScoreStorage.h"
+#include "PlayerInput.h"
+#include "Replay.h"
+#include "BotController.h"
+#include "TuningWatcher.h"
+#include "FrameProfiler.h"
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
 #include <vector>
 #include <memory>
 #include <string>
+#include <cstdint>
 
 enum class GameState { MENU, PLAYING, PAUSED, GAMEOVER, INSTRUCTIONS };
 
 class Game {
 private:
     sf::RenderWindow window;
-    sf::Font font;
-    sf::SoundBuffer shootBuffer, hitBuffer;
+    const sf::Font* font;
     sf::Sound shootSound, hitSound;
     sf::Music bgMusic;
     sf::Text pauseResumeText;
@@ -25,26 +31,31 @@ private:
 
     GameState currentState;
 
-    std::unique_ptr<PlayerTank> player;
-    std::vector<std::unique_ptr<EnemyTank>> enemies;
-    std::vector<std::unique_ptr<Bullet>> bullets;
-    std::vector<std::unique_ptr<Block>> levelBlocks;
+    World world;
+    Camera camera;
     std::unique_ptr<Background> background;
+    SpriteBatch batch;
+    BlockRenderer blockRenderer;
+    sf::CircleShape bulletShape;
 
     sf::Text titleText, scoreText, gameOverText;
     std::vector<sf::Text> menuOptions;
     std::vector<sf::Text> instructionTexts;
 
-    int score;
-    int level;
     std::vector<int> scoreHistory;
-    sf::Clock gameTimer, enemySpawnTimer;
-    float enemySpawnInterval;
+    sf::Clock gameTimer;
+
+    unsigned tickRate;
+    float tickDuration;
+    unsigned maxCatchUpSteps;
+    float accumulator;
+    float renderAlpha;
 
     int selectedOption;
 
-    int enemiesToDefeat;
-    int enemiesDefeated;
+    // Every match uses fixedSeed when one was given, otherwise a fresh seed
+    bool hasFixedSeed;
+    std::uint64_t fixedSeed;
 
     bool showLevelNotification = false;
     sf::Text levelNotificationText;
@@ -53,41 +64,87 @@ private:
 
     float levelNotificationDuration = 2.0f;
     bool mouseLeftPreviouslyPressed = false;
+    // Live input sampled each frame; a click stays latched until a tick applies it
+    PlayerInput pendingInput;
+    // Drives the player instead of the keyboard and mouse when set
+    std::unique_ptr<InputSource> inputSource;
+    // Plays live matches in place of the keyboard and mouse, restarting after each
+    std::unique_ptr<BotController> bot;
+    unsigned botMatches = 0;
+    Replay playback;
+    Replay recording;
+    std::string recordPath;
+    bool recordingActive = false;
+    // Replay ticks run back to back, drawing one frame every fastForwardEvery ticks
+    unsigned fastForwardEvery = 0;
+    bool audioEnabled = true;
+    // --config file, checked for edits a few times a second outside replays
+    // and recordings
+    TuningWatcher tuningWatcher;
+    sf::Clock tuningPollTimer;
+    // F3 overlay; its text is rebuilt a few times a second rather than every frame
+    FrameProfiler profiler;
+    sf::Text profilerText;
+    sf::RectangleShape profilerBackground;
+    sf::Clock profilerRefreshTimer;
+    // F5 saves the world here and F9 restores it
+    std::vector<std::uint8_t> quickSave;
+    // In-memory high score table; the storage only persists snapshots of it
     std::vector<int> highScores;
+    HighScoreStorage highScoreStorage;
 
 public:
-    Game();
+    Game(unsigned worldWidth = Constants::WORLD_WIDTH, unsigned worldHeight = Constants::WORLD_HEIGHT);
+    ~Game();
     void run();
 
-    static std::vector<int> loadHighScores();
-    static void saveHighScores(const std::vector<int>& scores);
+    void setTickRate(unsigned ticksPerSecond);
+    void setMaxCatchUpSteps(unsigned steps);
+    void setSeed(std::uint64_t seed);
+    // Every match is recorded to path and saved when it ends
+    void setRecordPath(const std::string& path);
+    // Plays replay back instead of taking live input
+    void startReplay(const Replay& replay);
+    // Hands the player tank to bot and starts a match; matches restart on their own
+    void setBot(std::unique_ptr<BotController> controller);
+    // Plays the replay at full CPU speed, rendering every Nth tick, then reports timings
+    void setFastForward(unsigned renderEveryTicks);
+    // Overrides the tuning values from path and reloads them whenever the file changes
+    bool setTuningFile(const std::string& path);
 private:
+    void preloadResources();
     void initializeFont();
     void setupUI();
-    void setupLevel();
-    void createLevelBlocks();
     void setupBackground();
 
+    void runFastForward();
     void handleEvents();
     void handleStateSpecificEvents(const sf::Event& event);
     void handleMenuEvents(const sf::Event& event);
     void executeMenuOption();
     void handleGameplayInput();
 
+    void finishRecording();
+    void finishBotMatch(const char* result);
+    void reloadTuning();
+    void applyTuningChanges();
+    void toggleProfiler();
+    void quickSaveWorld();
+    void quickLoadWorld();
+    void recordScore(int score);
     void startGame();
     void restartGame();
     void update(float deltaTime);
-    void spawnEnemies();
-    sf::Vector2f getRandomSpawnPosition();
-    void checkCollisions();
-    void cleanupObjects();
     void nextLevel();
 
+    void updateCamera();
+    bool isVisible(const sf::FloatRect& bounds) const;
     void render();
     void renderMenu();
     void renderBackground();
     void renderGame();
     void renderGameUI();
+    void renderProfiler();
     void renderPause();
     void renderGameOver();
     void renderInstructions();
@@ -1,13 +1,27 @@
 #include "GameObject.h"
 
 GameObject::GameObject(sf::Vector2f pos, float hp)
-    : position(pos), destroyed(false), health(hp), maxHealth(hp) {
+    : position(pos), previousPosition(pos), destroyed(false), health(hp), maxHealth(hp) {
 }
 
 sf::Vector2f GameObject::getCenter() const {
     return position;
 }
 
+void GameObject::storePreviousPosition() {
+    previousPosition = position;
+}
+
+sf::Vector2f GameObject::getInterpolatedPosition(float alpha) const {
+    return previousPosition + (position - previousPosition) * alpha;
+}
+
+sf::Transform GameObject::getRenderOffset(float alpha) const {
+    sf::Transform offset;
+    offset.translate(getInterpolatedPosition(alpha) - position);
+    return offset;
+}
+
 bool GameObject::isDestroyed() const {
     return destroyed;
 }
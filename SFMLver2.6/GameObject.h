@@ -5,6 +5,7 @@
 class GameObject : public IGameObject {
 protected:
     sf::Vector2f position;
+    sf::Vector2f previousPosition;
     bool destroyed;
     float health;
     float maxHealth;
@@ -16,6 +17,10 @@ public:
     sf::Vector2f getCenter() const override;
     bool isDestroyed() const override;
 
+    void storePreviousPosition();
+    sf::Vector2f getInterpolatedPosition(float alpha) const;
+    sf::Transform getRenderOffset(float alpha) const;
+
     float getHealth() const;
     float getMaxHealth() const;
     virtual void destroy();
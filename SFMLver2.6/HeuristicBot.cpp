@@ -0,0 +1,207 @@
+#include "HeuristicBot.h"
+#include "World.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Bullets closer than this at their closest approach would hit: half the
+    // tank sprite plus a bullet radius and a little slack
+    const float DANGER_RADIUS = 45.0f;
+    const float DODGE_HORIZON = 0.5f;
+
+    // The bot holds a band just outside the range enemies notice it from,
+    // where its faster bullets still reach them
+    const float STANDOFF_MIN_MARGIN = 20.0f;
+    const float STANDOFF_MAX_MARGIN = 120.0f;
+    const float FIRE_RANGE_MARGIN = 180.0f;
+    const float COVER_SEARCH_RADIUS = 240.0f;
+    // Below this share of health the bot stops trading shots and hides
+    const float HURT_HEALTH_RATIO = 0.3f;
+
+    // Strafe direction flips every STRAFE_TICKS so the bot is hard to lead
+    const long STRAFE_TICKS = 90;
+    const int STUCK_TICKS = 15;
+    const int DETOUR_TICKS = 30;
+
+    float length(sf::Vector2f v) {
+        return std::sqrt(v.x * v.x + v.y * v.y);
+    }
+
+    sf::Vector2f normalized(sf::Vector2f v) {
+        float len = length(v);
+        return len > 0 ? v / len : sf::Vector2f(0, 0);
+    }
+}
+
+HeuristicBot::HeuristicBot() {
+    restart();
+}
+
+void HeuristicBot::restart() {
+    tick = 0;
+    lastPosition = sf::Vector2f(0, 0);
+    stuckTicks = 0;
+    detourTicks = 0;
+    detour = sf::Vector2f(0, 0);
+}
+
+BotCommand HeuristicBot::decide(const World& world) {
+    BotCommand command;
+    const PlayerTank* player = world.getPlayer();
+    if (!player || player->isDestroyed()) return command;
+    tick++;
+
+    sf::Vector2f position = player->getCenter();
+    const EnemyTank* target = nullptr;
+    float targetDistance = 0.0f;
+    for (const auto& enemy : world.getEnemies()) {
+        if (enemy->isDestroyed()) continue;
+
+        float distance = length(enemy->getCenter() - position);
+        if (!target || distance < targetDistance) {
+            target = enemy.get();
+            targetDistance = distance;
+        }
+    }
+
+    const Tuning& tuning = world.getTuning();
+    float fireRange = tuning.enemyDetectionRange + FIRE_RANGE_MARGIN;
+    if (target) {
+        // Lead the shot by where the target will be when the bullet arrives
+        float travel = targetDistance / tuning.bulletSpeed;
+        sf::Vector2f predicted = target->getCenter() + target->getVelocity() * travel;
+        command.aim = predicted - position;
+        command.fire = targetDistance < fireRange && hasLineOfFire(world, position, predicted);
+    }
+
+    sf::Vector2f dodge = dodgeBullets(world, position);
+    if (dodge.x != 0 || dodge.y != 0) {
+        command.move = dodge;
+    }
+    else if (target) {
+        sf::Vector2f toTarget = normalized(target->getCenter() - position);
+        bool hurt = player->getHealth() < player->getMaxHealth() * HURT_HEALTH_RATIO;
+        sf::Vector2f cover;
+        if (hurt && findCover(world, position, target->getCenter(), cover)) {
+            // Close enough counts as in cover; stay still and shoot around it
+            sf::Vector2f toCover = cover - position;
+            if (length(toCover) > Constants::BLOCK_SIZE / 4.0f) {
+                command.move = toCover;
+            }
+        }
+        else if (targetDistance > tuning.enemyDetectionRange + STANDOFF_MAX_MARGIN) {
+            command.move = toTarget;
+        }
+        else if (targetDistance < tuning.enemyDetectionRange + STANDOFF_MIN_MARGIN) {
+            command.move = -toTarget;
+        }
+        else {
+            float side = (tick / STRAFE_TICKS) % 2 == 0 ? 1.0f : -1.0f;
+            command.move = sf::Vector2f(-toTarget.y, toTarget.x) * side;
+        }
+    }
+
+    // A tank pushing into a block does not move; slide sideways for a while
+    bool moving = command.move.x != 0 || command.move.y != 0;
+    if (detourTicks > 0) {
+        detourTicks--;
+        if (moving && dodge.x == 0 && dodge.y == 0) {
+            command.move = detour;
+        }
+    }
+    else if (moving && length(position - lastPosition) < 0.5f) {
+        if (++stuckTicks >= STUCK_TICKS) {
+            sf::Vector2f heading = normalized(command.move);
+            float side = (tick / STRAFE_TICKS) % 2 == 0 ? 1.0f : -1.0f;
+            detour = sf::Vector2f(-heading.y, heading.x) * side;
+            detourTicks = DETOUR_TICKS;
+            stuckTicks = 0;
+        }
+    }
+    else {
+        stuckTicks = 0;
+    }
+    lastPosition = position;
+    return command;
+}
+
+sf::Vector2f HeuristicBot::dodgeBullets(const World& world, sf::Vector2f position) const {
+    const BulletPool& bullets = world.getBullets();
+    sf::Vector2f away(0, 0);
+    for (size_t i = 0; i < bullets.size(); ++i) {
+        if (!bullets.isAlive(i) || bullets.isFromPlayer(i)) continue;
+
+        sf::Vector2f offset = bullets.getPosition(i) - position;
+        sf::Vector2f velocity = bullets.getVelocity(i);
+        float speedSquared = velocity.x * velocity.x + velocity.y * velocity.y;
+        if (speedSquared == 0) continue;
+
+        // Time and offset of the bullet's closest approach to the tank
+        float time = -(offset.x * velocity.x + offset.y * velocity.y) / speedSquared;
+        if (time < 0 || time > DODGE_HORIZON) continue;
+        sf::Vector2f closest = offset + velocity * time;
+        float miss = length(closest);
+        if (miss >= DANGER_RADIUS) continue;
+
+        // Step out of the bullet's path on the side it would miss on anyway;
+        // sooner and closer bullets weigh more
+        sf::Vector2f side = miss > 0.01f ? -closest / miss : normalized(sf::Vector2f(-velocity.y, velocity.x));
+        float weight = (1.0f - miss / DANGER_RADIUS) * (1.0f - time / DODGE_HORIZON) + 0.1f;
+        away += side * weight;
+    }
+    return away;
+}
+
+bool HeuristicBot::findCover(const World& world, sf::Vector2f position, sf::Vector2f threat,
+    sf::Vector2f& cover) const {
+    const sf::FloatRect& bounds = world.getBounds();
+    sf::FloatRect search(position.x - COVER_SEARCH_RADIUS, position.y - COVER_SEARCH_RADIUS,
+        COVER_SEARCH_RADIUS * 2, COVER_SEARCH_RADIUS * 2);
+    // Keep the query on the map so the grid lookup stays in range
+    search.left = std::max(search.left, bounds.left);
+    search.top = std::max(search.top, bounds.top);
+    search.width = std::min(search.left + search.width, bounds.left + bounds.width - 1.0f) - search.left;
+    search.height = std::min(search.top + search.height, bounds.top + bounds.height - 1.0f) - search.top;
+
+    float bestDistance = -1.0f;
+    world.getBlockGrid().forEachInArea(search, [&](const Block& block) {
+        if (!block.isBlocking()) return true;
+
+        // The spot on the far side of the block from the threat
+        sf::Vector2f away = normalized(block.getCenter() - threat);
+        sf::Vector2f spot = block.getCenter() + away * (Constants::BLOCK_SIZE / 2.0f + 35.0f);
+        if (!bounds.contains(spot)) return true;
+
+        sf::FloatRect footprint(spot.x - 20.0f, spot.y - 20.0f, 40.0f, 40.0f);
+        if (world.getBlockGrid().isAreaBlocked(footprint)) return true;
+
+        float distance = length(spot - position);
+        if (bestDistance < 0 || distance < bestDistance) {
+            bestDistance = distance;
+            cover = spot;
+        }
+        return true;
+    });
+    return bestDistance >= 0;
+}
+
+bool HeuristicBot::hasLineOfFire(const World& world, sf::Vector2f from, sf::Vector2f to) const {
+    // Sample the path at quarter-block steps; only blocking tiles stop bullets
+    sf::Vector2f path = to - from;
+    float distance = length(path);
+    float step = Constants::BLOCK_SIZE / 4.0f;
+    const sf::FloatRect& bounds = world.getBounds();
+    for (float travelled = step; travelled < distance; travelled += step) {
+        sf::Vector2f point = from + path * (travelled / distance);
+        if (!bounds.contains(point)) return true;
+
+        bool clear = true;
+        world.getBlockGrid().forEachInArea(sf::FloatRect(point.x - 3.0f, point.y - 3.0f, 6.0f, 6.0f),
+            [&clear](const Block& block) {
+                if (block.isBlocking()) clear = false;
+                return clear;
+            });
+        if (!clear) return false;
+    }
+    return true;
+}
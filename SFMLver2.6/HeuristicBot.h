@@ -0,0 +1,29 @@
+#pragma once
+#include "BotController.h"
+#include <SFML/Graphics/Rect.hpp>
+
+class World;
+
+// Bot meant to survive unattended soak runs. Each tick, in priority order:
+// sidestep enemy bullets that will pass close within the next half second,
+// fall back behind a block between it and the nearest enemy when badly hurt,
+// otherwise strafe just outside the range enemies detect it from. It leads
+// its shots and holds fire when a block is in the way.
+class HeuristicBot : public BotController {
+private:
+    long tick;
+    sf::Vector2f lastPosition;
+    int stuckTicks;
+    int detourTicks;
+    sf::Vector2f detour;
+
+    sf::Vector2f dodgeBullets(const World& world, sf::Vector2f position) const;
+    bool findCover(const World& world, sf::Vector2f position, sf::Vector2f threat, sf::Vector2f& cover) const;
+    bool hasLineOfFire(const World& world, sf::Vector2f from, sf::Vector2f to) const;
+
+public:
+    HeuristicBot();
+
+    BotCommand decide(const World& world) override;
+    void restart() override;
+};
@@ -0,0 +1,88 @@
+#include "HighScoreStorage.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+HighScoreStorage::HighScoreStorage(const std::string& filePath)
+    : path(filePath), hasPending(false), writing(false), stopping(false) {
+    worker = std::thread(&HighScoreStorage::run, this);
+}
+
+HighScoreStorage::~HighScoreStorage() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+std::vector<int> HighScoreStorage::load() const {
+    std::vector<int> scores;
+    std::ifstream in(path);
+    int s;
+    while (in >> s) {
+        scores.push_back(s);
+    }
+    std::sort(scores.rbegin(), scores.rend());
+    if (scores.size() > 10) scores.resize(10);
+    return scores;
+}
+
+void HighScoreStorage::saveAsync(const std::vector<int>& scores) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending = scores;
+        hasPending = true;
+    }
+    wake.notify_one();
+}
+
+void HighScoreStorage::flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this] { return !hasPending && !writing; });
+}
+
+void HighScoreStorage::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wake.wait(lock, [this] { return hasPending || stopping; });
+
+        // Pending snapshots are still written on shutdown
+        if (!hasPending && stopping) break;
+
+        std::vector<int> snapshot;
+        snapshot.swap(pending);
+        hasPending = false;
+        writing = true;
+
+        lock.unlock();
+        if (!writeAtomically(path, snapshot)) {
+            std::cerr << "Failed to save high scores to " << path << "\n";
+        }
+        lock.lock();
+
+        writing = false;
+        idle.notify_all();
+    }
+}
+
+bool HighScoreStorage::writeAtomically(const std::string& filePath, const std::vector<int>& scores) {
+    std::string tempPath = filePath + ".tmp";
+    {
+        std::ofstream out(tempPath, std::ios::trunc);
+        for (int s : scores) out << s << '\n';
+        if (!out) return false;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, filePath, error);
+    if (error) {
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+    return true;
+}
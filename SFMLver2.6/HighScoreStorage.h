@@ -0,0 +1,40 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+// Write-behind persistence for the high score table. saveAsync() hands a
+// snapshot to a background thread and returns immediately; only the newest
+// pending snapshot is written. Files are replaced atomically through a
+// temporary file and a rename, so a crash never leaves a truncated table.
+class HighScoreStorage {
+private:
+    std::string path;
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable idle;
+    std::vector<int> pending;
+    bool hasPending;
+    bool writing;
+    bool stopping;
+
+    void run();
+
+public:
+    explicit HighScoreStorage(const std::string& filePath);
+    ~HighScoreStorage();
+
+    HighScoreStorage(const HighScoreStorage&) = delete;
+    HighScoreStorage& operator=(const HighScoreStorage&) = delete;
+
+    std::vector<int> load() const;
+    void saveAsync(const std::vector<int>& scores);
+
+    // Blocks until every snapshot handed to saveAsync() is on disk
+    void flush();
+
+    static bool writeAtomically(const std::string& filePath, const std::vector<int>& scores);
+};
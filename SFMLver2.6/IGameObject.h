@@ -1,11 +1,13 @@
 #pragma once
+#include "SpriteBatch.h"
 #include <SFML/Graphics.hpp>
 
 class IGameObject {
 public:
     virtual ~IGameObject() = default;
     virtual void update(float deltaTime) = 0;
-    virtual void draw(sf::RenderWindow& window) = 0;
+    // alpha in [0, 1] blends between the previous and current simulation tick
+    virtual void draw(SpriteBatch& batch, float alpha) = 0;
     virtual sf::FloatRect getBounds() const = 0;
     virtual sf::Vector2f getCenter() const = 0;
     virtual bool isDestroyed() const = 0;
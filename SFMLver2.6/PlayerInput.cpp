@@ -0,0 +1,19 @@
+#include "PlayerInput.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+sf::Vector2f PlayerInput::getMovement() const {
+    sf::Vector2f movement(0, 0);
+    if (isPressed(MOVE_UP)) movement.y -= 1;
+    if (isPressed(MOVE_DOWN)) movement.y += 1;
+    if (isPressed(MOVE_LEFT)) movement.x -= 1;
+    if (isPressed(MOVE_RIGHT)) movement.x += 1;
+    return movement;
+}
+
+void PlayerInput::setAim(sf::Vector2f aim) {
+    const float limit = static_cast<float>(std::numeric_limits<std::int16_t>::max());
+    aimX = static_cast<std::int16_t>(std::round(std::max(-limit, std::min(limit, aim.x))));
+    aimY = static_cast<std::int16_t>(std::round(std::max(-limit, std::min(limit, aim.y))));
+}
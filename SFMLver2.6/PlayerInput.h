@@ -0,0 +1,47 @@
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <cstdint>
+
+class World;
+
+// Everything the player controls in one simulation tick. Aim is stored in
+// whole pixels relative to the tank so a recorded frame replays exactly what
+// the live game applied.
+struct PlayerInput {
+    enum Button : std::uint8_t {
+        MOVE_UP = 1 << 0,
+        MOVE_DOWN = 1 << 1,
+        MOVE_LEFT = 1 << 2,
+        MOVE_RIGHT = 1 << 3,
+        FIRE = 1 << 4
+    };
+
+    std::uint8_t buttons = 0;
+    std::int16_t aimX = 0;
+    std::int16_t aimY = 0;
+
+    bool isPressed(Button button) const { return (buttons & button) != 0; }
+    void press(Button button) { buttons |= button; }
+    void release(Button button) { buttons &= static_cast<std::uint8_t>(~button); }
+
+    sf::Vector2f getMovement() const;
+    sf::Vector2f getAim() const { return sf::Vector2f(aimX, aimY); }
+    void setAim(sf::Vector2f aim);
+
+    bool operator==(const PlayerInput& other) const {
+        return buttons == other.buttons && aimX == other.aimX && aimY == other.aimY;
+    }
+    bool operator!=(const PlayerInput& other) const { return !(*this == other); }
+};
+
+// Supplies one PlayerInput per tick to drive a World without a human at the
+// keyboard, e.g. from a recorded replay.
+class InputSource {
+public:
+    virtual ~InputSource() = default;
+
+    virtual PlayerInput nextInput(const World& world) = 0;
+    virtual bool isFinished() const { return false; }
+    // Called when a new match starts
+    virtual void restart() {}
+};
@@ -1,54 +1,68 @@
 #include "PlayerTank.h"
+#include "ResourceManager.h"
 #include <iostream>
 
-PlayerTank::PlayerTank(sf::Vector2f pos, std::vector<std::unique_ptr<Bullet>>* bullets)
+// Footprint of assets/Tank.png. Used as the hitbox when textures are not
+// loaded so headless matches collide exactly like rendered ones.
+static const sf::IntRect TANK_SPRITE_RECT(0, 0, 63, 64);
+
+PlayerTank::PlayerTank(sf::Vector2f pos, BulletPool* bullets, const Tuning* values)
     : BaseTank(pos, Constants::PLAYER_SPEED, sf::Color::Green, bullets), useTexture(false) {
 
-    maxAttackCooldown = Constants::PLAYER_ATTACK_COOLDOWN;
+    setTuning(values);
+    speed = tuning->playerSpeed;
+    maxAttackCooldown = tuning->playerAttackCooldown;
+    health = maxHealth = tuning->playerHealth;
 
-    if (texture.loadFromFile("assets/Tank.png")) {
+    ResourceManager::TextureRegion region = ResourceManager::instance().getTextureRegion("assets/Tank.png");
+    if (region.texture) {
         useTexture = true;
-        sprite.setTexture(texture);
-        sprite.setScale(1.f, 1.f);
-        sprite.setOrigin(static_cast<float>(texture.getSize().x) / 2.0f,
-            static_cast<float>(texture.getSize().y) / 2.0f);
-        sprite.setPosition(pos);
+        sprite.setTexture(*region.texture);
+        sprite.setTextureRect(region.rect);
+    }
+    else {
+        sprite.setTextureRect(TANK_SPRITE_RECT);
     }
+    sf::FloatRect local = sprite.getLocalBounds();
+    sprite.setScale(1.f, 1.f);
+    sprite.setOrigin(local.width / 2.0f, local.height / 2.0f);
+    sprite.setPosition(pos);
 }
 
 void PlayerTank::update(float deltaTime) {
-    if (!destroyed && useTexture) {
-        sprite.setPosition(position);
+    if (!destroyed) {
         sprite.setRotation(rotation + 90); 
     }
     BaseTank::update(deltaTime);
 }
 
-void PlayerTank::draw(sf::RenderWindow& window) {
+void PlayerTank::draw(SpriteBatch& batch, float alpha) {
     if (!destroyed) {
+        sf::Transform offset = getRenderOffset(alpha);
         if (useTexture) {
-            window.draw(sprite);
+            batch.draw(sprite, LAYER_TANKS, offset);
         }
         else {
-            window.draw(body);
+            batch.draw(body, LAYER_TANKS, offset);
         }
-        drawHealthBar(window);
+        drawHealthBar(batch, offset);
     }
 }
 
+void PlayerTank::setPosition(sf::Vector2f pos) {
+    BaseTank::setPosition(pos);
+    sprite.setPosition(pos);
+}
+
 void PlayerTank::setRotation(float angle) {
     BaseTank::setRotation(angle);
-    if (useTexture) {
-        sprite.setRotation(angle + 90.0f);
-    }
+    sprite.setRotation(angle + 90.0f);
 }
 
 void PlayerTank::createBullet(sf::Vector2f target) {
     sf::Vector2f direction = target - position;
-    auto bullet = std::make_unique<Bullet>(position, direction, 6.0f,
-        sf::Color::Yellow, Constants::BULLET_SPEED,
-        Constants::PLAYER_BULLET_DAMAGE, true);
-    bulletContainer->push_back(std::move(bullet));
+    bulletContainer->spawn(position, direction, 6.0f,
+        tuning->bulletSpeed, tuning->playerBulletDamage, true);
 }
 
 void PlayerTank::setScale(float x, float y) {
@@ -56,9 +70,5 @@ void PlayerTank::setScale(float x, float y) {
 }
 
 sf::FloatRect PlayerTank::getBounds() const {
-    if (useTexture) {
-        return sprite.getGlobalBounds();
-    } else {
-        return body.getGlobalBounds();
-    }
+    return sprite.getGlobalBounds();
 }
\ No newline at end of file
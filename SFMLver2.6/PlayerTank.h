@@ -4,18 +4,18 @@
 
 class PlayerTank : public BaseTank {
 private:
-    sf::Texture texture;
     sf::Sprite sprite;
     bool useTexture;
 
 public:
-    PlayerTank(sf::Vector2f pos, std::vector<std::unique_ptr<Bullet>>* bullets);
+    PlayerTank(sf::Vector2f pos, BulletPool* bullets, const Tuning* values = nullptr);
 
     sf::FloatRect getBounds() const override;
 
     void update(float deltaTime) override;
-    void draw(sf::RenderWindow& window) override;
+    void draw(SpriteBatch& batch, float alpha) override;
 
+    void setPosition(sf::Vector2f pos) override;
     void setRotation(float angle) override;
 
     void setScale(float x, float y);
@@ -0,0 +1,44 @@
+#include "Random.h"
+#include <random>
+
+Random::Random(std::uint64_t seedValue) {
+    seed(seedValue);
+}
+
+void Random::seed(std::uint64_t value) {
+    current.state = 0;
+    current.increment = (value << 1) | 1u;
+    next();
+    current.state += value;
+    next();
+}
+
+std::uint32_t Random::next() {
+    std::uint64_t old = current.state;
+    current.state = old * 6364136223846793005ULL + current.increment;
+    std::uint32_t shifted = static_cast<std::uint32_t>(((old >> 18) ^ old) >> 27);
+    std::uint32_t rotation = static_cast<std::uint32_t>(old >> 59);
+    return (shifted >> rotation) | (shifted << ((32 - rotation) & 31));
+}
+
+std::uint32_t Random::nextInt(std::uint32_t bound) {
+    if (bound == 0) return 0;
+
+    // Reject the low values that would bias the modulo
+    std::uint32_t threshold = (0u - bound) % bound;
+    for (;;) {
+        std::uint32_t value = next();
+        if (value >= threshold) {
+            return value % bound;
+        }
+    }
+}
+
+float Random::nextFloat() {
+    return static_cast<float>(next() >> 8) * (1.0f / 16777216.0f);
+}
+
+std::uint64_t Random::makeSeed() {
+    std::random_device device;
+    return (static_cast<std::uint64_t>(device()) << 32) | device();
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstdint>
+
+// Small seeded PCG32 generator (O'Neill, pcg-random.org). Every World owns
+// one, so a match is fully determined by its seed and several worlds can run
+// on different threads without sharing state the way rand() does.
+class Random {
+public:
+    struct State {
+        std::uint64_t state;
+        std::uint64_t increment;
+    };
+
+private:
+    State current;
+
+public:
+    explicit Random(std::uint64_t seed = 0);
+
+    void seed(std::uint64_t value);
+
+    std::uint32_t next();
+    // Uniform in [0, bound); returns 0 when bound is 0
+    std::uint32_t nextInt(std::uint32_t bound);
+    // Uniform in [0, 1)
+    float nextFloat();
+
+    const State& getState() const { return current; }
+    void setState(const State& state) { current = state; }
+
+    // Fresh seed from the system entropy source for unseeded runs
+    static std::uint64_t makeSeed();
+};
@@ -0,0 +1,210 @@
+#include "Replay.h"
+#include "Constants.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <cstring>
+
+namespace {
+    const char MAGIC[4] = { 'T', 'K', 'R', 'P' };
+    // Version 1 files have no tuning block and play back with the defaults
+    const std::uint16_t VERSION = 2;
+    const size_t MAX_RUN = 0xFFFF;
+    // Size of one run of identical frames in the file
+    const std::uint64_t RUN_BYTES = 7;
+
+    void writeBytes(std::ostream& out, std::uint64_t value, int count) {
+        for (int i = 0; i < count; ++i) {
+            out.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+        }
+    }
+
+    bool readBytes(std::istream& in, std::uint64_t& value, int count) {
+        value = 0;
+        for (int i = 0; i < count; ++i) {
+            int byte = in.get();
+            if (byte == EOF) return false;
+            value |= static_cast<std::uint64_t>(byte & 0xFF) << (8 * i);
+        }
+        return true;
+    }
+
+    // u8 count, then per value: u8 name length, the name, u32 float bits.
+    // Values go by name so a build that adds or reorders fields still reads
+    // older files.
+    void writeTuning(std::ostream& out, const Tuning& tuning) {
+        size_t count = 0;
+        while (Tuning::getFieldName(count)) count++;
+        writeBytes(out, count, 1);
+        for (size_t i = 0; i < count; ++i) {
+            const char* name = Tuning::getFieldName(i);
+            float value = 0.0f;
+            tuning.get(name, value);
+            std::uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+
+            size_t length = std::strlen(name);
+            writeBytes(out, length, 1);
+            out.write(name, static_cast<std::streamsize>(length));
+            writeBytes(out, bits, 4);
+        }
+    }
+
+    bool readTuning(std::istream& in, Tuning& tuning, const std::string& path) {
+        tuning = Tuning();
+        std::uint64_t count;
+        if (!readBytes(in, count, 1)) return false;
+        for (std::uint64_t i = 0; i < count; ++i) {
+            std::uint64_t length, bits;
+            char name[256];
+            if (!readBytes(in, length, 1) || !in.read(name, static_cast<std::streamsize>(length)) ||
+                !readBytes(in, bits, 4)) {
+                return false;
+            }
+
+            std::uint32_t raw = static_cast<std::uint32_t>(bits);
+            float value;
+            std::memcpy(&value, &raw, sizeof(value));
+            // The match cannot be reproduced without every value it ran with
+            if (!tuning.set(std::string(name, static_cast<size_t>(length)), value)) {
+                std::cerr << "Replay uses unknown tuning value " << std::string(name, static_cast<size_t>(length))
+                    << ": " << path << "\n";
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+Replay::Replay() : seed(0), tickRate(0), worldWidth(0), worldHeight(0) {
+}
+
+void Replay::begin(std::uint64_t matchSeed, unsigned ticksPerSecond, unsigned width, unsigned height,
+    const Tuning& values) {
+    seed = matchSeed;
+    tickRate = ticksPerSecond;
+    worldWidth = width;
+    worldHeight = height;
+    tuning = values;
+    frames.clear();
+}
+
+bool Replay::save(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        std::cerr << "Failed to write replay " << path << "\n";
+        return false;
+    }
+
+    // Runs of identical frames: u16 length, u8 buttons, i16 aimX, i16 aimY
+    std::vector<std::pair<size_t, size_t>> runs;
+    for (size_t i = 0; i < frames.size(); ++i) {
+        if (!runs.empty() && runs.back().second < MAX_RUN && frames[runs.back().first] == frames[i]) {
+            runs.back().second++;
+        }
+        else {
+            runs.emplace_back(i, 1);
+        }
+    }
+
+    out.write(MAGIC, sizeof(MAGIC));
+    writeBytes(out, VERSION, 2);
+    writeBytes(out, seed, 8);
+    writeBytes(out, tickRate, 4);
+    writeBytes(out, worldWidth, 4);
+    writeBytes(out, worldHeight, 4);
+    writeTuning(out, tuning);
+    writeBytes(out, frames.size(), 4);
+    writeBytes(out, runs.size(), 4);
+    for (const auto& run : runs) {
+        const PlayerInput& frame = frames[run.first];
+        writeBytes(out, run.second, 2);
+        writeBytes(out, frame.buttons, 1);
+        writeBytes(out, static_cast<std::uint16_t>(frame.aimX), 2);
+        writeBytes(out, static_cast<std::uint16_t>(frame.aimY), 2);
+    }
+    return static_cast<bool>(out);
+}
+
+bool Replay::load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    char magic[4] = {};
+    if (!in.read(magic, sizeof(magic)) || !std::equal(magic, magic + 4, MAGIC)) {
+        std::cerr << "Not a replay file: " << path << "\n";
+        return false;
+    }
+
+    std::uint64_t version, fileSeed, rate, width, height, frameCount, runCount;
+    Tuning fileTuning;
+    if (!readBytes(in, version, 2) || version < 1 || version > VERSION ||
+        !readBytes(in, fileSeed, 8) || !readBytes(in, rate, 4) ||
+        !readBytes(in, width, 4) || !readBytes(in, height, 4) ||
+        (version >= 2 && !readTuning(in, fileTuning, path)) ||
+        !readBytes(in, frameCount, 4) || !readBytes(in, runCount, 4) ||
+        // The same limits --world and the tick rate setting enforce
+        rate == 0 || width < Constants::WINDOW_WIDTH || height < Constants::WINDOW_HEIGHT) {
+        std::cerr << "Unsupported or truncated replay header: " << path << "\n";
+        return false;
+    }
+
+    // Only reserve what the runs in the file can actually hold, so a corrupt
+    // header cannot ask for gigabytes before the runs are read
+    std::streamoff start = in.tellg();
+    in.seekg(0, std::ios::end);
+    std::uint64_t remaining = static_cast<std::uint64_t>(in.tellg() - start);
+    in.seekg(start);
+    if (!in || runCount > remaining / RUN_BYTES || frameCount > runCount * MAX_RUN) {
+        std::cerr << "Replay header does not match its contents: " << path << "\n";
+        return false;
+    }
+
+    std::vector<PlayerInput> loaded;
+    loaded.reserve(static_cast<size_t>(frameCount));
+    for (std::uint64_t i = 0; i < runCount; ++i) {
+        std::uint64_t length, buttons, aimX, aimY;
+        if (!readBytes(in, length, 2) || !readBytes(in, buttons, 1) ||
+            !readBytes(in, aimX, 2) || !readBytes(in, aimY, 2)) {
+            std::cerr << "Truncated replay: " << path << "\n";
+            return false;
+        }
+
+        if (length > frameCount - loaded.size()) {
+            std::cerr << "Replay frame count mismatch: " << path << "\n";
+            return false;
+        }
+
+        PlayerInput frame;
+        frame.buttons = static_cast<std::uint8_t>(buttons);
+        frame.aimX = static_cast<std::int16_t>(static_cast<std::uint16_t>(aimX));
+        frame.aimY = static_cast<std::int16_t>(static_cast<std::uint16_t>(aimY));
+        loaded.insert(loaded.end(), static_cast<size_t>(length), frame);
+    }
+    if (loaded.size() != frameCount) {
+        std::cerr << "Replay frame count mismatch: " << path << "\n";
+        return false;
+    }
+
+    seed = fileSeed;
+    tickRate = static_cast<unsigned>(rate);
+    worldWidth = static_cast<unsigned>(width);
+    worldHeight = static_cast<unsigned>(height);
+    tuning = fileTuning;
+    frames.swap(loaded);
+    return true;
+}
+
+ReplayInput::ReplayInput(const Replay& source) : replay(source), position(0) {
+}
+
+PlayerInput ReplayInput::nextInput(const World&) {
+    if (position >= replay.size()) return PlayerInput();
+    return replay.getFrame(position++);
+}
+
+bool ReplayInput::isFinished() const {
+    return position >= replay.size();
+}
+
+void ReplayInput::restart() {
+    position = 0;
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include "PlayerInput.h"
+#include "Tuning.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// One recorded match: the World seed and size, the tick rate, the tuning
+// values and the input applied on every tick. Files are little-endian binary
+// with identical consecutive frames run-length encoded, so idle stretches
+// cost nothing.
+class Replay {
+private:
+    std::uint64_t seed;
+    unsigned tickRate;
+    unsigned worldWidth;
+    unsigned worldHeight;
+    Tuning tuning;
+    std::vector<PlayerInput> frames;
+
+public:
+    Replay();
+
+    void begin(std::uint64_t matchSeed, unsigned ticksPerSecond, unsigned width, unsigned height,
+        const Tuning& values);
+    void append(const PlayerInput& input) { frames.push_back(input); }
+
+    std::uint64_t getSeed() const { return seed; }
+    unsigned getTickRate() const { return tickRate; }
+    unsigned getWorldWidth() const { return worldWidth; }
+    unsigned getWorldHeight() const { return worldHeight; }
+    const Tuning& getTuning() const { return tuning; }
+    size_t size() const { return frames.size(); }
+    const PlayerInput& getFrame(size_t tick) const { return frames[tick]; }
+
+    bool save(const std::string& path) const;
+    bool load(const std::string& path);
+};
+
+// Feeds a Replay's frames back one per tick.
+class ReplayInput : public InputSource {
+private:
+    const Replay& replay;
+    size_t position;
+
+public:
+    explicit ReplayInput(const Replay& source);
+
+    PlayerInput nextInput(const World& world) override;
+    bool isFinished() const override;
+    void restart() override;
+};
@@ -0,0 +1,110 @@
+#include "ResourceManager.h"
+#include <iostream>
+
+ResourceManager::ResourceManager() : loadingEnabled(true) {
+}
+
+ResourceManager& ResourceManager::instance() {
+    static ResourceManager manager;
+    return manager;
+}
+
+template <typename T>
+const T* ResourceManager::acquire(std::unordered_map<std::string, std::unique_ptr<T>>& cache, const std::string& path) {
+    if (!loadingEnabled) return nullptr;
+
+    auto it = cache.find(path);
+    if (it != cache.end()) {
+        stats.hits++;
+        return it->second.get();
+    }
+
+    auto resource = std::make_unique<T>();
+    if (!resource->loadFromFile(path)) {
+        std::cerr << "Failed to load resource: " << path << "\n";
+        stats.failures++;
+        resource.reset();
+    }
+    else {
+        stats.loads++;
+    }
+
+    const T* result = resource.get();
+    cache.emplace(path, std::move(resource));
+    return result;
+}
+
+const sf::Texture* ResourceManager::getTexture(const std::string& path) {
+    return acquire(textures, path);
+}
+
+const sf::SoundBuffer* ResourceManager::getSoundBuffer(const std::string& path) {
+    return acquire(soundBuffers, path);
+}
+
+const sf::Font* ResourceManager::getFont(const std::string& path) {
+    return acquire(fonts, path);
+}
+
+ResourceManager::TextureRegion ResourceManager::getTextureRegion(const std::string& path) {
+    TextureRegion region;
+    if (!loadingEnabled) return region;
+
+    if (const sf::IntRect* rect = atlas.findRegion(path)) {
+        stats.hits++;
+        region.texture = &atlas.getTexture();
+        region.rect = *rect;
+        return region;
+    }
+
+    region.texture = getTexture(path);
+    if (region.texture) {
+        sf::Vector2u size = region.texture->getSize();
+        region.rect = sf::IntRect(0, 0, static_cast<int>(size.x), static_cast<int>(size.y));
+    }
+    return region;
+}
+
+bool ResourceManager::buildAtlas(const std::vector<std::string>& paths) {
+    if (!loadingEnabled) return false;
+
+    bool built = atlas.build(paths);
+    if (built) {
+        for (const auto& path : paths) {
+            if (atlas.findRegion(path)) stats.loads++;
+            else stats.failures++;
+        }
+    }
+    return built;
+}
+
+void ResourceManager::preloadTextures(const std::vector<std::string>& paths) {
+    for (const auto& path : paths) {
+        getTexture(path);
+    }
+}
+
+void ResourceManager::preloadSoundBuffers(const std::vector<std::string>& paths) {
+    for (const auto& path : paths) {
+        getSoundBuffer(path);
+    }
+}
+
+void ResourceManager::setLoadingEnabled(bool enabled) {
+    loadingEnabled = enabled;
+}
+
+bool ResourceManager::isLoadingEnabled() const {
+    return loadingEnabled;
+}
+
+const ResourceManager::Stats& ResourceManager::getStats() const {
+    return stats;
+}
+
+void ResourceManager::clear() {
+    textures.clear();
+    atlas.clear();
+    soundBuffers.clear();
+    fonts.clear();
+}
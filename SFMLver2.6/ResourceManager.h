@@ -0,0 +1,67 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <SFML/Audio.hpp>
+#include "TextureAtlas.h"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Process-wide cache of textures, sound buffers and fonts keyed by file path.
+// Each file is read from disk at most once; later lookups are a hash lookup
+// returning a pointer that stays valid until clear().
+class ResourceManager {
+public:
+    // Texture plus the part of it holding one image. Images packed into the
+    // atlas all share the atlas texture.
+    struct TextureRegion {
+        const sf::Texture* texture = nullptr;
+        sf::IntRect rect;
+    };
+
+    struct Stats {
+        unsigned loads = 0;
+        unsigned hits = 0;
+        unsigned failures = 0;
+    };
+
+private:
+    std::unordered_map<std::string, std::unique_ptr<sf::Texture>> textures;
+    std::unordered_map<std::string, std::unique_ptr<sf::SoundBuffer>> soundBuffers;
+    std::unordered_map<std::string, std::unique_ptr<sf::Font>> fonts;
+    TextureAtlas atlas;
+    Stats stats;
+    bool loadingEnabled;
+
+    ResourceManager();
+
+    // Failed loads are cached as nullptr so a missing file is not retried per spawn
+    template <typename T>
+    const T* acquire(std::unordered_map<std::string, std::unique_ptr<T>>& cache, const std::string& path);
+
+public:
+    ResourceManager(const ResourceManager&) = delete;
+    ResourceManager& operator=(const ResourceManager&) = delete;
+
+    static ResourceManager& instance();
+
+    const sf::Texture* getTexture(const std::string& path);
+    const sf::SoundBuffer* getSoundBuffer(const std::string& path);
+    const sf::Font* getFont(const std::string& path);
+
+    // Atlas sub-rect when the image was packed by buildAtlas(), otherwise the
+    // whole standalone texture
+    TextureRegion getTextureRegion(const std::string& path);
+    bool buildAtlas(const std::vector<std::string>& paths);
+
+    void preloadTextures(const std::vector<std::string>& paths);
+    void preloadSoundBuffers(const std::vector<std::string>& paths);
+
+    // Headless runs disable loading: every lookup then returns nullptr and
+    // entities fall back to their untextured shapes
+    void setLoadingEnabled(bool enabled);
+    bool isLoadingEnabled() const;
+
+    const Stats& getStats() const;
+    void clear();
+};
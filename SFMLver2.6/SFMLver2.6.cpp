@@ -1,10 +1,281 @@
 #include "Game.h"
+#include "World.h"
+#include "ResourceManager.h"
+#include "AllocationCounter.h"
+#include "BulletIntegrator.h"
+#include "Replay.h"
+#include "WorldSandbox.h"
+#include "BotController.h"
 #include <iostream>
 #include <exception>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <cstdlib>
+#include <cstdint>
+#include <vector>
+
+static const char* statusName(WorldStatus status) {
+    switch (status) {
+    case WorldStatus::RUNNING: return "running";
+    case WorldStatus::LEVEL_CLEARED: return "level cleared";
+    case WorldStatus::GAME_OVER: return "game over";
+    case WorldStatus::VICTORY: return "victory";
+    }
+    return "unknown";
+}
+
+// Branches a sandbox off world and plays count one-second rollouts from it,
+// each holding one of the four movement directions while firing
+static void benchmarkRollouts(const World& world, long count, unsigned tickRate, float deltaTime) {
+    static const PlayerInput::Button MOVES[4] = {
+        PlayerInput::MOVE_UP, PlayerInput::MOVE_DOWN, PlayerInput::MOVE_LEFT, PlayerInput::MOVE_RIGHT
+    };
+
+    WorldSandbox sandbox(static_cast<unsigned>(world.getBounds().width), static_cast<unsigned>(world.getBounds().height));
+    if (!sandbox.branchFrom(world)) {
+        std::cerr << "Rollouts: could not branch the world\n";
+        return;
+    }
+    // Warm up once so the sandbox has its enemies and storage before counting
+    sandbox.rewind();
+
+    size_t allocationsBefore = AllocationCounter::getCount();
+    auto start = std::chrono::steady_clock::now();
+    long steps = 0;
+    int bestScore = 0;
+    for (long i = 0; i < count; ++i) {
+        sandbox.rewind();
+        PlayerInput input;
+        input.press(MOVES[i % 4]);
+        input.press(PlayerInput::FIRE);
+        input.setAim(sf::Vector2f(100.0f, 0.0f));
+        for (unsigned tick = 0; tick < tickRate; ++tick) {
+            steps++;
+            if (!sandbox.step(input, deltaTime)) break;
+        }
+        bestScore = std::max(bestScore, sandbox.getWorld().getScore());
+    }
+    double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    size_t allocations = AllocationCounter::getCount() - allocationsBefore;
+
+    std::cout << "Rollouts: " << count << " x " << tickRate << " ticks in " << wallMs << " ms, "
+        << (wallMs > 0 ? count * 1000.0 / wallMs : 0.0) << " rollouts/s, " << steps << " ticks, "
+        << allocations << " heap allocations, best score " << bestScore << "\n";
+}
+
+// Steps a World at the fixed tick rate with no window, audio or textures.
+// With an input source (a replay or a bot) the player is driven by it until
+// it runs out.
+static int runHeadless(long ticks, unsigned tickRate, unsigned worldWidth, unsigned worldHeight,
+    std::uint64_t seed, const Tuning& tuning, InputSource* input, long rollouts) {
+    ResourceManager::instance().setLoadingEnabled(false);
+
+    World world(worldWidth, worldHeight);
+    world.setTuning(tuning);
+    world.reset(seed);
+    // Driven runs are benchmarks, so their ticks are broken down by phase
+    world.setProfiling(input != nullptr);
+
+    const float deltaTime = 1.0f / static_cast<float>(tickRate);
+    auto start = std::chrono::steady_clock::now();
+
+    // Rollouts branch off the middle of the run, where combat is under way
+    long rolloutTick = rollouts > 0 ? ticks / 2 : -1;
+    long tick = 0;
+    size_t tickAllocations = 0;
+    long allocatingTicks = 0;
+    while (tick < ticks) {
+        if (input && input->isFinished()) break;
+        if (tick == rolloutTick) {
+            benchmarkRollouts(world, rollouts, tickRate, deltaTime);
+        }
+
+        size_t before = AllocationCounter::getCount();
+        if (input) {
+            world.applyInput(input->nextInput(world));
+        }
+        world.update(deltaTime);
+        size_t allocated = AllocationCounter::getCount() - before;
+        tickAllocations += allocated;
+        if (allocated > 0) allocatingTicks++;
+        tick++;
+
+        if (world.getStatus() == WorldStatus::LEVEL_CLEARED) {
+            world.setupLevel();
+        }
+        else if (world.getStatus() != WorldStatus::RUNNING) {
+            break;
+        }
+    }
+
+    double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    double ticksPerSecond = wallMs > 0 ? tick * 1000.0 / wallMs : 0.0;
+    std::cout << "Ticks: " << tick << " (" << tick * deltaTime << " s simulated) in " << wallMs << " ms, "
+        << ticksPerSecond << " ticks/s (" << ticksPerSecond / tickRate << "x real time)\n";
+    std::cout << "Seed: " << world.getSeed() << "\n";
+    std::cout << "Result: " << statusName(world.getStatus()) << ", level " << world.getLevel()
+        << ", score " << world.getScore() << "\n";
+    const MatchStats& stats = world.getStats();
+    std::cout << "Player: " << stats.timeAlive << " s alive, " << stats.shotsFired << " shots, "
+        << stats.getAccuracy() * 100.0f << "% accuracy, " << stats.damageTaken << " damage taken\n";
+    std::cout << "Flow field: " << world.getFlowField().getRebuilds() << " rebuilds, "
+        << world.getFlowField().getIncrementalUpdates() << " incremental updates\n";
+    const AIScheduler::Stats& ai = world.getAIScheduler().getStats();
+    std::cout << "AI thinks: " << ai.fullThinks << " full, " << ai.reducedThinks << " reduced, "
+        << ai.deferred << " deferred by budget\n";
+    std::cout << "Bullet integrator: " << BulletIntegrator::getKernelName() << "\n";
+    std::cout << "Heap allocations inside ticks: " << tickAllocations
+        << " (" << allocatingTicks << " of " << tick << " ticks allocated)\n";
+    if (input) {
+        std::cout << "Time per phase:\n";
+        world.writeProfile(std::cout, tick);
+    }
+
+    // Round trip of the final state: saving again after a restore must give
+    // back the same bytes
+    std::vector<std::uint8_t> snapshot;
+    std::vector<std::uint8_t> resaved;
+    auto saveStart = std::chrono::steady_clock::now();
+    world.saveSnapshot(snapshot);
+    auto restoreStart = std::chrono::steady_clock::now();
+    bool restored = world.restoreSnapshot(snapshot);
+    auto restoreEnd = std::chrono::steady_clock::now();
+    world.saveSnapshot(resaved);
+    std::cout << "Snapshot: " << snapshot.size() << " bytes, save "
+        << std::chrono::duration<double, std::micro>(restoreStart - saveStart).count() << " us, restore "
+        << std::chrono::duration<double, std::micro>(restoreEnd - restoreStart).count() << " us, round trip "
+        << (restored && resaved == snapshot ? "ok" : "MISMATCH") << "\n";
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    bool headless = false;
+    long ticks = 60L * 60L * Constants::TICK_RATE;
+    unsigned tickRate = Constants::TICK_RATE;
+    bool allowSimd = true;
+    unsigned worldWidth = Constants::WORLD_WIDTH;
+    unsigned worldHeight = Constants::WORLD_HEIGHT;
+    bool hasSeed = false;
+    std::uint64_t seed = 0;
+    std::string recordPath;
+    std::string replayPath;
+    std::string configPath;
+    std::string botName;
+    unsigned fastForwardEvery = 0;
+    long rollouts = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--headless") {
+            headless = true;
+        }
+        else if (arg == "--ticks" && i + 1 < argc) {
+            ticks = std::atol(argv[++i]);
+        }
+        else if (arg == "--tick-rate" && i + 1 < argc) {
+            tickRate = static_cast<unsigned>(std::max(1L, std::atol(argv[++i])));
+        }
+        else if (arg == "--world" && i + 2 < argc) {
+            // Anything smaller than the window is padded out to it
+            worldWidth = static_cast<unsigned>(std::max(static_cast<long>(Constants::WINDOW_WIDTH), std::atol(argv[++i])));
+            worldHeight = static_cast<unsigned>(std::max(static_cast<long>(Constants::WINDOW_HEIGHT), std::atol(argv[++i])));
+        }
+        else if (arg == "--seed" && i + 1 < argc) {
+            hasSeed = true;
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--record" && i + 1 < argc) {
+            recordPath = argv[++i];
+        }
+        else if (arg == "--replay" && i + 1 < argc) {
+            replayPath = argv[++i];
+        }
+        else if (arg == "--config" && i + 1 < argc) {
+            configPath = argv[++i];
+        }
+        else if (arg == "--bot" && i + 1 < argc) {
+            botName = argv[++i];
+        }
+        else if (arg == "--fast-forward" && i + 1 < argc) {
+            fastForwardEvery = static_cast<unsigned>(std::max(1L, std::atol(argv[++i])));
+        }
+        else if (arg == "--rollouts" && i + 1 < argc) {
+            rollouts = std::max(0L, std::atol(argv[++i]));
+        }
+        else if (arg == "--no-simd") {
+            allowSimd = false;
+        }
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--tick-rate N] [--world W H] [--seed N] [--config FILE] [--no-simd]"
+                << " [--record FILE | --replay FILE [--fast-forward N] | --bot turret|heuristic]"
+                << " [--headless [--ticks N] [--rollouts N]]\n";
+            return -1;
+        }
+    }
+
+    std::unique_ptr<BotController> bot;
+    if (!botName.empty()) {
+        bot = createBot(botName);
+        if (!bot) {
+            std::cerr << "Unknown bot: " << botName << " (expected turret or heuristic)\n";
+            return -1;
+        }
+        if (!replayPath.empty()) {
+            std::cerr << "--bot and --replay both drive the player; use one\n";
+            return -1;
+        }
+    }
+
+    if (!configPath.empty() && !replayPath.empty()) {
+        std::cerr << "--config cannot be used with --replay; a replay plays back with its own tuning\n";
+        return -1;
+    }
+
+    BulletIntegrator::select(allowSimd);
 
-int main() {
     try {
-        Game game;
+        // A replay brings its own seed, tick rate, world size and tuning
+        Replay replay;
+        bool replaying = !replayPath.empty();
+        if (replaying) {
+            if (!replay.load(replayPath)) return -1;
+            tickRate = replay.getTickRate();
+            worldWidth = replay.getWorldWidth();
+            worldHeight = replay.getWorldHeight();
+            std::cout << "Replaying " << replayPath << ": " << replay.size() << " ticks, seed "
+                << replay.getSeed() << "\n";
+        }
+
+        if (headless) {
+            Tuning tuning;
+            if (!configPath.empty() && !loadTuning(configPath, tuning)) return -1;
+
+            if (replaying) {
+                ReplayInput input(replay);
+                return runHeadless(static_cast<long>(replay.size()), tickRate, worldWidth, worldHeight,
+                    replay.getSeed(), replay.getTuning(), &input, rollouts);
+            }
+            return runHeadless(ticks, tickRate, worldWidth, worldHeight,
+                hasSeed ? seed : Random::makeSeed(), tuning, bot.get(), rollouts);
+        }
+
+        Game game(worldWidth, worldHeight);
+        game.setTickRate(tickRate);
+        if (hasSeed) {
+            game.setSeed(seed);
+        }
+        if (!recordPath.empty()) {
+            game.setRecordPath(recordPath);
+        }
+        if (!configPath.empty() && !game.setTuningFile(configPath)) return -1;
+        if (replaying) {
+            game.setFastForward(fastForwardEvery);
+            game.startReplay(replay);
+        }
+        else if (bot) {
+            game.setBot(std::move(bot));
+        }
         game.run();
     }
     catch (const std::exception& e) {
@@ -13,4 +284,4 @@ int main() {
     }
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,113 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+// Byte-level helpers for World snapshots. Values are copied in native byte
+// order, so a snapshot is meant to be restored by the same build on the same
+// machine (quicksave, rollback, bisecting), not exchanged between platforms.
+class SnapshotWriter {
+private:
+    std::vector<std::uint8_t>& buffer;
+
+public:
+    explicit SnapshotWriter(std::vector<std::uint8_t>& out) : buffer(out) {}
+
+    void writeBytes(const void* data, size_t size) {
+        const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    }
+
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable<T>::value, "snapshot values must be trivially copyable");
+        static_assert(!std::is_same<T, bool>::value, "write flags with writeFlag()");
+        writeBytes(&value, sizeof(T));
+    }
+
+    // One byte, 0 or 1
+    void writeFlag(bool value) {
+        write(static_cast<std::uint8_t>(value ? 1 : 0));
+    }
+
+    // Element count followed by the raw elements
+    template <typename T>
+    void writeArray(const std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable<T>::value, "snapshot values must be trivially copyable");
+        write(static_cast<std::uint32_t>(values.size()));
+        if (!values.empty()) {
+            writeBytes(values.data(), values.size() * sizeof(T));
+        }
+    }
+};
+
+// Reads what SnapshotWriter wrote. Running past the end marks the reader as
+// failed and leaves the remaining values zeroed instead of reading garbage.
+class SnapshotReader {
+private:
+    const std::uint8_t* data;
+    size_t size;
+    size_t offset;
+    bool failed;
+
+public:
+    SnapshotReader(const std::uint8_t* bytes, size_t length) : data(bytes), size(length), offset(0), failed(false) {}
+
+    bool readBytes(void* out, size_t length) {
+        if (failed || length > size - offset) {
+            failed = true;
+            std::memset(out, 0, length);
+            return false;
+        }
+        std::memcpy(out, data + offset, length);
+        offset += length;
+        return true;
+    }
+
+    // Not for bool: any byte other than 0 or 1 is not a valid bool, so flags
+    // go through readFlag()
+    template <typename T>
+    T read() {
+        static_assert(std::is_trivially_copyable<T>::value, "snapshot values must be trivially copyable");
+        static_assert(!std::is_same<T, bool>::value, "read flags with readFlag()");
+        T value;
+        readBytes(&value, sizeof(T));
+        return value;
+    }
+
+    template <typename T>
+    void read(T& value) {
+        value = read<T>();
+    }
+
+    // Counterpart of writeFlag. A byte other than 0 or 1 fails the reader.
+    bool readFlag() {
+        std::uint8_t value = read<std::uint8_t>();
+        if (value > 1) {
+            failed = true;
+            return false;
+        }
+        return value != 0;
+    }
+
+    // Counterpart of writeArray. Resizing within the reserved capacity does
+    // not allocate, which keeps restores into pooled storage heap-free.
+    template <typename T>
+    bool readArray(std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable<T>::value, "snapshot values must be trivially copyable");
+        std::uint32_t count = read<std::uint32_t>();
+        if (failed || static_cast<size_t>(count) * sizeof(T) > size - offset) {
+            failed = true;
+            return false;
+        }
+        values.resize(count);
+        return count == 0 || readBytes(values.data(), count * sizeof(T));
+    }
+
+    bool ok() const { return !failed; }
+    bool atEnd() const { return offset == size; }
+    // Bytes not read yet, for bounding a count before anything is allocated
+    size_t remaining() const { return size - offset; }
+};
@@ -0,0 +1,129 @@
+#include "SpriteBatch.h"
+#include <algorithm>
+#include <cstdlib>
+
+SpriteBatch::SpriteBatch() : lastBatch(0), drawCalls(0) {
+}
+
+sf::VertexArray& SpriteBatch::getVertices(int layer, const sf::Texture* texture) {
+    // Consecutive submissions usually share a batch
+    if (lastBatch < batches.size() && batches[lastBatch].layer == layer && batches[lastBatch].texture == texture) {
+        return batches[lastBatch].vertices;
+    }
+
+    for (size_t i = 0; i < batches.size(); ++i) {
+        if (batches[i].layer == layer && batches[i].texture == texture) {
+            lastBatch = i;
+            return batches[i].vertices;
+        }
+    }
+
+    batches.push_back({ layer, texture, sf::VertexArray(sf::Triangles) });
+    lastBatch = batches.size() - 1;
+    return batches.back().vertices;
+}
+
+void SpriteBatch::appendQuad(sf::VertexArray& vertices, const sf::Transform& transform,
+    const sf::FloatRect& local, const sf::FloatRect& texCoords, sf::Color color) {
+
+    float right = local.left + local.width;
+    float bottom = local.top + local.height;
+    float texRight = texCoords.left + texCoords.width;
+    float texBottom = texCoords.top + texCoords.height;
+
+    sf::Vertex topLeft(transform.transformPoint(local.left, local.top), color, sf::Vector2f(texCoords.left, texCoords.top));
+    sf::Vertex topRight(transform.transformPoint(right, local.top), color, sf::Vector2f(texRight, texCoords.top));
+    sf::Vertex bottomRight(transform.transformPoint(right, bottom), color, sf::Vector2f(texRight, texBottom));
+    sf::Vertex bottomLeft(transform.transformPoint(local.left, bottom), color, sf::Vector2f(texCoords.left, texBottom));
+
+    vertices.append(topLeft);
+    vertices.append(topRight);
+    vertices.append(bottomRight);
+    vertices.append(topLeft);
+    vertices.append(bottomRight);
+    vertices.append(bottomLeft);
+}
+
+void SpriteBatch::draw(const sf::Sprite& sprite, int layer, const sf::Transform& offset) {
+    const sf::Texture* texture = sprite.getTexture();
+    if (!texture) return;
+
+    sf::IntRect rect = sprite.getTextureRect();
+    sf::FloatRect local(0.0f, 0.0f, static_cast<float>(std::abs(rect.width)), static_cast<float>(std::abs(rect.height)));
+    sf::FloatRect texCoords(static_cast<float>(rect.left), static_cast<float>(rect.top),
+        static_cast<float>(rect.width), static_cast<float>(rect.height));
+
+    sf::Transform transform = offset * sprite.getTransform();
+    appendQuad(getVertices(layer, texture), transform, local, texCoords, sprite.getColor());
+}
+
+void SpriteBatch::draw(const sf::Shape& shape, int layer, const sf::Transform& offset) {
+    std::size_t count = shape.getPointCount();
+    if (count < 3) return;
+
+    const sf::Texture* texture = shape.getTexture();
+    sf::VertexArray& vertices = getVertices(layer, texture);
+    sf::Transform transform = offset * shape.getTransform();
+    sf::Color color = shape.getFillColor();
+
+    // Map local points into the texture rect the same way sf::Shape does
+    sf::FloatRect bounds = shape.getLocalBounds();
+    sf::IntRect rect = shape.getTextureRect();
+    auto vertexAt = [&](std::size_t index) {
+        sf::Vector2f point = shape.getPoint(index);
+        sf::Vector2f texCoords;
+        if (texture && bounds.width > 0 && bounds.height > 0) {
+            texCoords.x = rect.left + rect.width * (point.x - bounds.left) / bounds.width;
+            texCoords.y = rect.top + rect.height * (point.y - bounds.top) / bounds.height;
+        }
+        return sf::Vertex(transform.transformPoint(point), color, texCoords);
+    };
+
+    // Shapes are convex, so a fan around the first point covers them
+    sf::Vertex first = vertexAt(0);
+    sf::Vertex previous = vertexAt(1);
+    for (std::size_t i = 2; i < count; ++i) {
+        sf::Vertex current = vertexAt(i);
+        vertices.append(first);
+        vertices.append(previous);
+        vertices.append(current);
+        previous = current;
+    }
+}
+
+void SpriteBatch::drawRect(const sf::FloatRect& rect, sf::Color color, int layer, const sf::Transform& offset) {
+    appendQuad(getVertices(layer, nullptr), offset, rect, sf::FloatRect(), color);
+}
+
+void SpriteBatch::drawStatic(const sf::VertexArray& vertices, const sf::Texture* texture, int layer) {
+    if (vertices.getVertexCount() == 0) return;
+    statics.push_back({ layer, texture, &vertices });
+}
+
+void SpriteBatch::flush(sf::RenderTarget& target) {
+    order.assign(statics.begin(), statics.end());
+    for (const Batch& batch : batches) {
+        if (batch.vertices.getVertexCount() > 0) {
+            order.push_back({ batch.layer, batch.texture, &batch.vertices });
+        }
+    }
+    std::stable_sort(order.begin(), order.end(), [](const Submission& a, const Submission& b) {
+        return a.layer < b.layer;
+    });
+
+    drawCalls = 0;
+    for (const Submission& submission : order) {
+        target.draw(*submission.vertices, sf::RenderStates(submission.texture));
+        drawCalls++;
+    }
+    statics.clear();
+
+    // Keep the vertex storage around for the next frame
+    for (auto& batch : batches) {
+        batch.vertices.clear();
+    }
+}
+
+unsigned SpriteBatch::getDrawCalls() const {
+    return drawCalls;
+}
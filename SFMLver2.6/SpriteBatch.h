@@ -0,0 +1,57 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+enum RenderLayer {
+    LAYER_BACKGROUND = 0,
+    LAYER_BLOCKS,
+    LAYER_TANKS,
+    LAYER_BULLETS,
+    LAYER_HEALTH_BARS
+};
+
+// Collects sprites, shapes and plain rectangles into one triangle list per
+// (layer, texture) and submits each list with a single draw call on flush().
+// Layers are drawn in ascending order; shape outlines are not batched.
+// Prebuilt vertex arrays can be submitted with drawStatic(); they are drawn
+// in place, ahead of the batched geometry of the same layer.
+class SpriteBatch {
+private:
+    struct Batch {
+        int layer;
+        const sf::Texture* texture;
+        sf::VertexArray vertices;
+    };
+
+    struct Submission {
+        int layer;
+        const sf::Texture* texture;
+        const sf::VertexArray* vertices;
+    };
+
+    std::vector<Batch> batches;
+    std::vector<Submission> statics;
+    std::vector<Submission> order;
+    size_t lastBatch;
+    unsigned drawCalls;
+
+    sf::VertexArray& getVertices(int layer, const sf::Texture* texture);
+    void appendQuad(sf::VertexArray& vertices, const sf::Transform& transform,
+        const sf::FloatRect& local, const sf::FloatRect& texCoords, sf::Color color);
+
+public:
+    SpriteBatch();
+
+    void draw(const sf::Sprite& sprite, int layer, const sf::Transform& offset = sf::Transform::Identity);
+    void draw(const sf::Shape& shape, int layer, const sf::Transform& offset = sf::Transform::Identity);
+    void drawRect(const sf::FloatRect& rect, sf::Color color, int layer,
+        const sf::Transform& offset = sf::Transform::Identity);
+
+    // The array is not copied and must stay alive until the next flush()
+    void drawStatic(const sf::VertexArray& vertices, const sf::Texture* texture, int layer);
+
+    void flush(sf::RenderTarget& target);
+
+    // Draw calls issued by the most recent flush()
+    unsigned getDrawCalls() const;
+};
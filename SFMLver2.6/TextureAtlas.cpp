@@ -0,0 +1,85 @@
+#include "TextureAtlas.h"
+#include <algorithm>
+#include <iostream>
+
+bool TextureAtlas::build(const std::vector<std::string>& paths) {
+    clear();
+
+    std::vector<std::string> names;
+    std::vector<sf::Image> images;
+    for (const auto& path : paths) {
+        sf::Image image;
+        if (!image.loadFromFile(path)) {
+            std::cerr << "Atlas: failed to load " << path << "\n";
+            continue;
+        }
+        names.push_back(path);
+        images.push_back(image);
+    }
+    if (images.empty()) return false;
+
+    unsigned maxSize = sf::Texture::getMaximumSize();
+    unsigned width = PREFERRED_WIDTH;
+    for (const auto& image : images) {
+        width = std::max(width, image.getSize().x + 2 * PADDING);
+    }
+    width = std::min(width, maxSize);
+
+    // Shelf packing: tallest images first, left to right, new shelf when full
+    std::vector<size_t> order(images.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::sort(order.begin(), order.end(), [&images](size_t a, size_t b) {
+        return images[a].getSize().y > images[b].getSize().y;
+    });
+
+    std::vector<sf::Vector2u> placement(images.size());
+    unsigned x = PADDING, y = PADDING, shelfHeight = 0;
+    for (size_t index : order) {
+        sf::Vector2u size = images[index].getSize();
+        if (x + size.x + PADDING > width) {
+            y += shelfHeight + PADDING;
+            x = PADDING;
+            shelfHeight = 0;
+        }
+        placement[index] = sf::Vector2u(x, y);
+        x += size.x + PADDING;
+        shelfHeight = std::max(shelfHeight, size.y);
+    }
+    unsigned height = y + shelfHeight + PADDING;
+
+    if (height > maxSize) {
+        std::cerr << "Atlas: " << width << "x" << height << " exceeds the maximum texture size\n";
+        return false;
+    }
+
+    sf::Image atlas;
+    atlas.create(width, height, sf::Color::Transparent);
+    for (size_t i = 0; i < images.size(); ++i) {
+        sf::Vector2u size = images[i].getSize();
+        atlas.copy(images[i], placement[i].x, placement[i].y);
+        regions[names[i]] = sf::IntRect(static_cast<int>(placement[i].x), static_cast<int>(placement[i].y),
+            static_cast<int>(size.x), static_cast<int>(size.y));
+    }
+
+    if (!texture.loadFromImage(atlas)) {
+        regions.clear();
+        return false;
+    }
+
+    std::cout << "Atlas built: " << regions.size() << " images in " << width << "x" << height << std::endl;
+    return true;
+}
+
+const sf::Texture& TextureAtlas::getTexture() const {
+    return texture;
+}
+
+const sf::IntRect* TextureAtlas::findRegion(const std::string& path) const {
+    auto it = regions.find(path);
+    return it != regions.end() ? &it->second : nullptr;
+}
+
+void TextureAtlas::clear() {
+    regions.clear();
+    texture = sf::Texture();
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Packs several image files into one texture with a simple shelf packer so
+// everything drawn from it can share a single SpriteBatch draw call.
+class TextureAtlas {
+private:
+    sf::Texture texture;
+    std::unordered_map<std::string, sf::IntRect> regions;
+
+    static const unsigned PADDING = 2;
+    static const unsigned PREFERRED_WIDTH = 2048;
+
+public:
+    // Loads every image and uploads the packed result once. Images that fail
+    // to load are skipped; returns false if nothing could be packed.
+    bool build(const std::vector<std::string>& paths);
+
+    const sf::Texture& getTexture() const;
+    const sf::IntRect* findRegion(const std::string& path) const;
+    void clear();
+};
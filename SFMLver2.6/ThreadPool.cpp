@@ -0,0 +1,94 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+ThreadPool::ThreadPool(unsigned threads)
+    : nextQueue(0), queued(0), unfinished(0), stopping(false) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    for (unsigned i = 0; i < threads; ++i) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    for (unsigned i = 0; i < threads; ++i) {
+        workers.emplace_back(&ThreadPool::run, this, static_cast<size_t>(i));
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    size_t index = nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        queues[index]->tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lock(stateMutex);
+        queued++;
+        unfinished++;
+    }
+    wake.notify_one();
+}
+
+void ThreadPool::wait() {
+    std::unique_lock<std::mutex> lock(stateMutex);
+    idle.wait(lock, [this] { return unfinished == 0; });
+}
+
+bool ThreadPool::takeTask(size_t self, std::function<void()>& task) {
+    // Own deque from the back: the most recently dealt task
+    {
+        Queue& own = *queues[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+
+    // Other deques from the front, starting with the next worker
+    for (size_t offset = 1; offset < queues.size(); ++offset) {
+        Queue& victim = *queues[(self + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::run(size_t self) {
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(stateMutex);
+            wake.wait(lock, [this] { return queued > 0 || stopping; });
+            if (queued == 0) return;
+            // Claiming the count first means a task exists in some deque for us
+            queued--;
+        }
+
+        std::function<void()> task;
+        while (!takeTask(self, task)) {
+            std::this_thread::yield();
+        }
+        task();
+
+        std::lock_guard<std::mutex> lock(stateMutex);
+        if (--unfinished == 0) {
+            idle.notify_all();
+        }
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <vector>
+
+// Fixed set of worker threads with one task deque each. Submitted tasks are
+// dealt round-robin; a worker takes from the back of its own deque and, once
+// that is empty, steals from the front of the others, so uneven tasks (short
+// and long matches) still keep every core busy.
+class ThreadPool {
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<size_t> nextQueue;
+
+    std::mutex stateMutex;
+    std::condition_variable wake;
+    std::condition_variable idle;
+    size_t queued;
+    size_t unfinished;
+    bool stopping;
+
+    bool takeTask(size_t self, std::function<void()>& task);
+    void run(size_t self);
+
+public:
+    // 0 threads means one per hardware thread
+    explicit ThreadPool(unsigned threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void submit(std::function<void()> task);
+    // Blocks until every submitted task has finished
+    void wait();
+
+    size_t getThreadCount() const { return workers.size(); }
+};
@@ -0,0 +1,118 @@
+#include "Tilemap.h"
+#include <algorithm>
+#include <cmath>
+
+Tilemap::Tilemap(unsigned width, unsigned height, unsigned tile, unsigned chunk)
+    : columns(static_cast<int>((width + tile - 1) / tile)),
+    rows(static_cast<int>((height + tile - 1) / tile)),
+    chunkTiles(static_cast<int>(std::max(1u, chunk))),
+    tileSize(static_cast<float>(tile)) {
+    chunkColumns = (columns + chunkTiles - 1) / chunkTiles;
+    chunkRows = (rows + chunkTiles - 1) / chunkTiles;
+    tiles.assign(static_cast<size_t>(columns) * rows, 0);
+    // Revisions start at 1 so a renderer's zeroed cache is stale from the start
+    chunkRevisions.assign(static_cast<size_t>(chunkColumns) * chunkRows, 1);
+}
+
+int Tilemap::chunkIndexOf(int x, int y) const {
+    return (y / chunkTiles) * chunkColumns + x / chunkTiles;
+}
+
+void Tilemap::touch(int x, int y, std::uint8_t before, std::uint8_t after) {
+    if (before == after) return;
+
+    // Only static tiles are baked, so trees coming and going leave chunks alone
+    bool staticBefore = before != 0 && isStatic(static_cast<BlockType>(before - 1));
+    bool staticAfter = after != 0 && isStatic(static_cast<BlockType>(after - 1));
+    if (staticBefore || staticAfter) {
+        chunkRevisions[chunkIndexOf(x, y)]++;
+    }
+}
+
+void Tilemap::clear() {
+    for (int y = 0; y < rows; ++y) {
+        for (int x = 0; x < columns; ++x) {
+            clearTile(x, y);
+        }
+    }
+}
+
+void Tilemap::setTile(int x, int y, BlockType type) {
+    if (!isInside(x, y)) return;
+
+    std::uint8_t& tile = tiles[y * columns + x];
+    std::uint8_t value = static_cast<std::uint8_t>(static_cast<int>(type) + 1);
+    touch(x, y, tile, value);
+    tile = value;
+}
+
+void Tilemap::clearTile(int x, int y) {
+    if (!isInside(x, y)) return;
+
+    std::uint8_t& tile = tiles[y * columns + x];
+    touch(x, y, tile, 0);
+    tile = 0;
+}
+
+void Tilemap::saveState(SnapshotWriter& out) const {
+    out.write(columns);
+    out.write(rows);
+    out.writeArray(tiles);
+}
+
+bool Tilemap::loadState(SnapshotReader& in) {
+    int savedColumns = in.read<int>();
+    int savedRows = in.read<int>();
+    std::uint32_t count = in.read<std::uint32_t>();
+    if (!in.ok() || savedColumns != columns || savedRows != rows || count != tiles.size()) {
+        return false;
+    }
+
+    // Tiles are compared straight from the reader so a restore needs no
+    // scratch buffer
+    for (int y = 0; y < rows; ++y) {
+        for (int x = 0; x < columns; ++x) {
+            std::uint8_t value = in.read<std::uint8_t>();
+            // 0 is an empty tile, so BLOCK_TYPE_COUNT is the largest valid value
+            if (value > BLOCK_TYPE_COUNT) return false;
+            if (value == tiles[y * columns + x]) continue;
+            if (value == 0) clearTile(x, y);
+            else setTile(x, y, static_cast<BlockType>(value - 1));
+        }
+    }
+    return in.ok();
+}
+
+bool Tilemap::isInside(int x, int y) const {
+    return x >= 0 && y >= 0 && x < columns && y < rows;
+}
+
+bool Tilemap::hasTile(int x, int y) const {
+    return isInside(x, y) && tiles[y * columns + x] != 0;
+}
+
+BlockType Tilemap::getTile(int x, int y) const {
+    return static_cast<BlockType>(tiles[y * columns + x] - 1);
+}
+
+bool Tilemap::isStatic(BlockType type) {
+    return !getBlockStyle(type).destructible;
+}
+
+sf::Vector2i Tilemap::tileAt(sf::Vector2f point) const {
+    return sf::Vector2i(static_cast<int>(std::floor(point.x / tileSize)),
+        static_cast<int>(std::floor(point.y / tileSize)));
+}
+
+sf::Vector2f Tilemap::tileCenter(int x, int y) const {
+    return sf::Vector2f((x + 0.5f) * tileSize, (y + 0.5f) * tileSize);
+}
+
+unsigned Tilemap::getChunkRevision(int chunkX, int chunkY) const {
+    return chunkRevisions[chunkY * chunkColumns + chunkX];
+}
+
+sf::FloatRect Tilemap::getChunkBounds(int chunkX, int chunkY) const {
+    float span = chunkTiles * tileSize;
+    return sf::FloatRect(chunkX * span, chunkY * span, span, span);
+}
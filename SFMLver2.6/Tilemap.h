@@ -0,0 +1,58 @@
+#pragma once
+#include "Constants.h"
+#include "Block.h"
+#include "Snapshot.h"
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <cstdint>
+
+// Level layout as a grid of Constants::BLOCK_SIZE tiles, split into square
+// chunks of Constants::TILE_CHUNK_SIZE tiles. Every chunk carries a revision
+// that is bumped whenever one of its static tiles (types that cannot be
+// destroyed) changes, so renderers can keep a baked copy of a chunk until its
+// revision moves on.
+class Tilemap {
+private:
+    int columns;
+    int rows;
+    int chunkTiles;
+    int chunkColumns;
+    int chunkRows;
+    float tileSize;
+    std::vector<std::uint8_t> tiles;  // BlockType + 1, 0 for an empty tile
+    std::vector<unsigned> chunkRevisions;
+
+    int chunkIndexOf(int x, int y) const;
+    void touch(int x, int y, std::uint8_t before, std::uint8_t after);
+
+public:
+    Tilemap(unsigned width = Constants::WORLD_WIDTH, unsigned height = Constants::WORLD_HEIGHT,
+        unsigned tile = Constants::BLOCK_SIZE, unsigned chunk = Constants::TILE_CHUNK_SIZE);
+
+    void clear();
+    void setTile(int x, int y, BlockType type);
+    void clearTile(int x, int y);
+
+    // Restoring goes through setTile/clearTile, so chunks whose static tiles
+    // differ from the snapshot get new revisions
+    void saveState(SnapshotWriter& out) const;
+    bool loadState(SnapshotReader& in);
+
+    bool isInside(int x, int y) const;
+    bool hasTile(int x, int y) const;
+    BlockType getTile(int x, int y) const;
+
+    static bool isStatic(BlockType type);
+
+    sf::Vector2i tileAt(sf::Vector2f point) const;
+    sf::Vector2f tileCenter(int x, int y) const;
+    float getTileSize() const { return tileSize; }
+    int getColumns() const { return columns; }
+    int getRows() const { return rows; }
+
+    int getChunkTiles() const { return chunkTiles; }
+    int getChunkColumns() const { return chunkColumns; }
+    int getChunkRows() const { return chunkRows; }
+    unsigned getChunkRevision(int chunkX, int chunkY) const;
+    sf::FloatRect getChunkBounds(int chunkX, int chunkY) const;
+};
@@ -0,0 +1,131 @@
+#include "Tuning.h"
+#include <fstream>
+#include <iostream>
+#include <cstdlib>
+
+namespace {
+    struct Field {
+        const char* name;
+        float Tuning::* member;
+    };
+
+    const Field FIELDS[] = {
+        { "PLAYER_SPEED", &Tuning::playerSpeed },
+        { "ENEMY_SPEED", &Tuning::enemySpeed },
+        { "BULLET_SPEED", &Tuning::bulletSpeed },
+        { "ENEMY_BULLET_SPEED", &Tuning::enemyBulletSpeed },
+        { "PLAYER_HEALTH", &Tuning::playerHealth },
+        { "ENEMY_HEALTH", &Tuning::enemyHealth },
+        { "PLAYER_BULLET_DAMAGE", &Tuning::playerBulletDamage },
+        { "ENEMY_BULLET_DAMAGE", &Tuning::enemyBulletDamage },
+        { "PLAYER_ATTACK_COOLDOWN", &Tuning::playerAttackCooldown },
+        { "ENEMY_ATTACK_COOLDOWN", &Tuning::enemyAttackCooldown },
+        { "ENEMY_SPAWN_INTERVAL", &Tuning::enemySpawnInterval },
+        { "AI_UPDATE_INTERVAL", &Tuning::aiUpdateInterval },
+        { "ENEMY_DETECTION_RANGE", &Tuning::enemyDetectionRange },
+        { "ENEMY_MIN_DISTANCE", &Tuning::enemyMinDistance },
+        { "ENEMY_MAX_DISTANCE", &Tuning::enemyMaxDistance }
+    };
+
+    std::string trim(const std::string& text) {
+        size_t first = text.find_first_not_of(" \t\r");
+        if (first == std::string::npos) return std::string();
+        size_t last = text.find_last_not_of(" \t\r");
+        return text.substr(first, last - first + 1);
+    }
+}
+
+bool Tuning::set(const std::string& name, float value) {
+    for (const Field& field : FIELDS) {
+        if (name == field.name) {
+            this->*field.member = value;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Tuning::get(const std::string& name, float& value) const {
+    for (const Field& field : FIELDS) {
+        if (name == field.name) {
+            value = this->*field.member;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* Tuning::getFieldName(size_t index) {
+    return index < sizeof(FIELDS) / sizeof(FIELDS[0]) ? FIELDS[index].name : nullptr;
+}
+
+bool Tuning::operator==(const Tuning& other) const {
+    for (const Field& field : FIELDS) {
+        if (this->*field.member != other.*field.member) return false;
+    }
+    return true;
+}
+
+const Tuning& Tuning::defaults() {
+    static const Tuning values;
+    return values;
+}
+
+bool loadTuningSets(const std::string& path, std::vector<TuningSet>& sets) {
+    std::ifstream in(path);
+    if (!in) {
+        std::cerr << "Failed to open parameter file " << path << "\n";
+        return false;
+    }
+
+    sets.clear();
+    Tuning shared;
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(in, line)) {
+        lineNumber++;
+        line = trim(line.substr(0, line.find('#')));
+        if (line.empty()) continue;
+
+        if (line.front() == '[') {
+            if (line.back() != ']' || line.size() < 3) {
+                std::cerr << path << ":" << lineNumber << ": bad section header\n";
+                return false;
+            }
+            sets.push_back({ trim(line.substr(1, line.size() - 2)), shared });
+            continue;
+        }
+
+        size_t equals = line.find('=');
+        std::string name = trim(line.substr(0, equals));
+        std::string text = equals == std::string::npos ? std::string() : trim(line.substr(equals + 1));
+        char* end = nullptr;
+        float value = std::strtof(text.c_str(), &end);
+        if (text.empty() || *end != '\0') {
+            std::cerr << path << ":" << lineNumber << ": expected NAME = number\n";
+            return false;
+        }
+
+        Tuning& target = sets.empty() ? shared : sets.back().values;
+        if (!target.set(name, value)) {
+            std::cerr << path << ":" << lineNumber << ": unknown parameter " << name << "\n";
+            return false;
+        }
+    }
+
+    if (sets.empty()) {
+        sets.push_back({ "default", shared });
+    }
+    return true;
+}
+
+bool loadTuning(const std::string& path, Tuning& values) {
+    std::vector<TuningSet> sets;
+    if (!loadTuningSets(path, sets)) return false;
+
+    if (sets.size() > 1) {
+        std::cerr << path << ": " << sets.size() << " parameter sets, using [" << sets.front().name << "]\n";
+    }
+    values = sets.front().values;
+    return true;
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include "Constants.h"
+#include <string>
+#include <vector>
+
+// Gameplay values that can be changed without a rebuild, for balancing. The
+// defaults are the Constants of the same name. Each World holds its own copy
+// and its tanks read it through a pointer, so matches on different threads
+// can run different values.
+struct Tuning {
+    float playerSpeed = Constants::PLAYER_SPEED;
+    float enemySpeed = Constants::ENEMY_SPEED;
+    float bulletSpeed = Constants::BULLET_SPEED;
+    float enemyBulletSpeed = Constants::ENEMY_BULLET_SPEED;
+    float playerHealth = Constants::PLAYER_HEALTH;
+    float enemyHealth = Constants::ENEMY_HEALTH;
+    float playerBulletDamage = Constants::PLAYER_BULLET_DAMAGE;
+    float enemyBulletDamage = Constants::ENEMY_BULLET_DAMAGE;
+    float playerAttackCooldown = Constants::PLAYER_ATTACK_COOLDOWN;
+    float enemyAttackCooldown = Constants::ENEMY_ATTACK_COOLDOWN;
+    float enemySpawnInterval = Constants::ENEMY_SPAWN_INTERVAL;
+    float aiUpdateInterval = Constants::AI_UPDATE_INTERVAL;
+    float enemyDetectionRange = Constants::ENEMY_DETECTION_RANGE;
+    float enemyMinDistance = Constants::ENEMY_MIN_DISTANCE;
+    float enemyMaxDistance = Constants::ENEMY_MAX_DISTANCE;
+
+    // Sets the value named after its constant, e.g. "PLAYER_SPEED". False
+    // for unknown names.
+    bool set(const std::string& name, float value);
+    bool get(const std::string& name, float& value) const;
+    // Constant-style names of every value in declaration order, for writing
+    // them out; null past the last one
+    static const char* getFieldName(size_t index);
+    bool operator==(const Tuning& other) const;
+    bool operator!=(const Tuning& other) const { return !(*this == other); }
+
+    static const Tuning& defaults();
+};
+
+// One named configuration from a parameter file
+struct TuningSet {
+    std::string name;
+    Tuning values;
+};
+
+// Reads "NAME = value" lines; '#' starts a comment. Lines before the first
+// "[name]" header apply to every set and each header starts a new set, so a
+// file without headers gives one set called "default". Reports the first bad
+// line and returns false.
+bool loadTuningSets(const std::string& path, std::vector<TuningSet>& sets);
+
+// Single configuration, for the game's --config file. Values the file does
+// not mention keep their defaults; with several sets the first one is used.
+bool loadTuning(const std::string& path, Tuning& values);
@@ -0,0 +1,36 @@
+#include "TuningWatcher.h"
+
+TuningWatcher::TuningWatcher() : watching(false) {
+}
+
+bool TuningWatcher::open(const std::string& filePath, Tuning& values) {
+    path = filePath;
+    watching = false;
+
+    std::error_code error;
+    lastWrite = std::filesystem::last_write_time(path, error);
+    if (error || !loadTuning(path, values)) return false;
+
+    watching = true;
+    return true;
+}
+
+bool TuningWatcher::poll(Tuning& values) {
+    if (!watching) return false;
+
+    std::error_code error;
+    std::filesystem::file_time_type writeTime = std::filesystem::last_write_time(path, error);
+    if (error || writeTime == lastWrite) return false;
+
+    // Editors that truncate before writing leave a moment where the file is
+    // empty; it is read again once the write lands
+    if (std::filesystem::file_size(path, error) == 0 || error) return false;
+    lastWrite = writeTime;
+
+    // Parsed over the defaults, so deleting a line reverts that value
+    Tuning loaded;
+    if (!loadTuning(path, loaded) || loaded == values) return false;
+
+    values = loaded;
+    return true;
+}
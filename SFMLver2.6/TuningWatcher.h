@@ -0,0 +1,26 @@
+#pragma once
+#include "Tuning.h"
+#include <string>
+#include <filesystem>
+
+// Keeps a Tuning in step with its config file. poll() is cheap enough to
+// call every frame: it only stats the file, and parses it again after the
+// modification time changes.
+class TuningWatcher {
+private:
+    std::string path;
+    std::filesystem::file_time_type lastWrite;
+    bool watching;
+
+public:
+    TuningWatcher();
+
+    // Loads path into values and starts watching it
+    bool open(const std::string& filePath, Tuning& values);
+    // True when the file changed and parsed into values that differ from
+    // the current ones. A file that fails to parse leaves values as they were.
+    bool poll(Tuning& values);
+
+    bool isWatching() const { return watching; }
+    const std::string& getPath() const { return path; }
+};
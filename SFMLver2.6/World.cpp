@@ -0,0 +1,527 @@
+#include "World.h"
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+#include <iomanip>
+
+namespace {
+    const std::uint32_t SNAPSHOT_MAGIC = 0x534B4E54;  // "TNKS"
+    const std::uint32_t SNAPSHOT_VERSION = 3;
+    // Smallest possible encoding of one block and one enemy, so a corrupt
+    // count is rejected before anything is reserved or constructed
+    const size_t BLOCK_RECORD_BYTES = sizeof(sf::Vector2f) + sizeof(BlockType) + sizeof(float) + 1;
+    const size_t ENEMY_RECORD_BYTES = 4 * sizeof(sf::Vector2f) + 7 * sizeof(float) + 3;
+}
+
+const char* getPhaseName(int phase) {
+    static const char* const NAMES[PHASE_COUNT] = {
+        "input", "player", "flow field", "ai think", "enemies", "bullets", "spawn", "collisions", "cleanup"
+    };
+    return phase >= 0 && phase < PHASE_COUNT ? NAMES[phase] : "unknown";
+}
+
+World::World(unsigned width, unsigned height)
+    : tilemap(width, height), blockGrid(width, height), broadphase(width, height), flowField(width, height),
+    bounds(0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height)), seed(0), random(0),
+    status(WorldStatus::RUNNING), score(0), level(1), enemiesToDefeat(0), enemiesDefeated(0),
+    enemySpawnTimer(0.0f), enemySpawnInterval(tuning.enemySpawnInterval), profiling(false) {
+    resetProfile();
+}
+
+void World::setTuning(const Tuning& values) {
+    tuning = values;
+
+    // Same steps nextLevel() takes from the base interval
+    enemySpawnInterval = tuning.enemySpawnInterval;
+    for (int i = 1; i < level; ++i) {
+        enemySpawnInterval = std::max(1.0f, enemySpawnInterval - 0.2f);
+    }
+
+    if (player) {
+        player->setSpeed(tuning.playerSpeed);
+        player->setAttackCooldown(tuning.playerAttackCooldown);
+    }
+    for (auto& enemy : enemies) {
+        enemy->setSpeed(tuning.enemySpeed);
+        enemy->setAttackCooldown(tuning.enemyAttackCooldown);
+    }
+}
+
+void World::setProfiling(bool enabled) {
+    profiling = enabled;
+}
+
+void World::resetProfile() {
+    for (double& seconds : phaseSeconds) {
+        seconds = 0.0;
+    }
+}
+
+void World::writeProfile(std::ostream& out, long ticks) const {
+    double total = 0.0;
+    for (double seconds : phaseSeconds) {
+        total += seconds;
+    }
+
+    std::ios::fmtflags flags = out.flags();
+    out << std::fixed << std::setprecision(2);
+    for (int phase = 0; phase < PHASE_COUNT; ++phase) {
+        double ms = phaseSeconds[phase] * 1000.0;
+        double perTick = ticks > 0 ? phaseSeconds[phase] * 1e6 / ticks : 0.0;
+        double share = total > 0 ? phaseSeconds[phase] * 100.0 / total : 0.0;
+        out << "  " << std::left << std::setw(12) << getPhaseName(phase) << std::right
+            << std::setw(10) << ms << " ms " << std::setw(8) << perTick << " us/tick "
+            << std::setw(6) << share << "%\n";
+    }
+    out.flags(flags);
+}
+
+void World::saveSnapshot(std::vector<std::uint8_t>& out) const {
+    out.clear();
+    SnapshotWriter writer(out);
+    writer.write(SNAPSHOT_MAGIC);
+    writer.write(SNAPSHOT_VERSION);
+    writer.write(bounds);
+
+    writer.write(seed);
+    writer.write(random.getState());
+    writer.write(tuning);
+    writer.write(stats);
+    writer.write(status);
+    writer.write(score);
+    writer.write(level);
+    writer.write(enemiesToDefeat);
+    writer.write(enemiesDefeated);
+    writer.write(enemySpawnTimer);
+    writer.write(enemySpawnInterval);
+
+    tilemap.saveState(writer);
+    writer.write(static_cast<std::uint32_t>(levelBlocks.size()));
+    for (const Block& block : levelBlocks) {
+        writer.write(block.getCenter());
+        writer.write(block.getType());
+        writer.write(block.getHealth());
+        writer.writeFlag(block.isDestroyed());
+    }
+    flowField.saveState(writer);
+    aiScheduler.saveState(writer);
+
+    writer.writeFlag(player != nullptr);
+    if (player) {
+        player->saveState(writer);
+    }
+    writer.write(static_cast<std::uint32_t>(enemies.size()));
+    for (const auto& enemy : enemies) {
+        enemy->saveState(writer);
+    }
+    bullets.saveState(writer);
+}
+
+bool World::restoreSnapshot(const std::vector<std::uint8_t>& data) {
+    SnapshotReader reader(data.data(), data.size());
+    std::uint32_t magic = reader.read<std::uint32_t>();
+    std::uint32_t version = reader.read<std::uint32_t>();
+    sf::FloatRect savedBounds = reader.read<sf::FloatRect>();
+    if (!reader.ok() || magic != SNAPSHOT_MAGIC || version != SNAPSHOT_VERSION || savedBounds != bounds) {
+        return false;
+    }
+
+    reader.read(seed);
+    random.setState(reader.read<Random::State>());
+    reader.read(tuning);
+    reader.read(stats);
+    reader.read(status);
+    reader.read(score);
+    reader.read(level);
+    reader.read(enemiesToDefeat);
+    reader.read(enemiesDefeated);
+    reader.read(enemySpawnTimer);
+    reader.read(enemySpawnInterval);
+    if (!reader.ok() || static_cast<int>(status) < 0 || status > WorldStatus::VICTORY) return false;
+
+    if (!tilemap.loadState(reader)) return false;
+
+    // The grid points into levelBlocks, so it is rebuilt once every block is back
+    std::uint32_t blockCount = reader.read<std::uint32_t>();
+    if (!reader.ok() || blockCount > reader.remaining() / BLOCK_RECORD_BYTES) return false;
+    levelBlocks.clear();
+    levelBlocks.reserve(blockCount);
+    for (std::uint32_t i = 0; i < blockCount && reader.ok(); ++i) {
+        sf::Vector2f position = reader.read<sf::Vector2f>();
+        BlockType type = reader.read<BlockType>();
+        float health = reader.read<float>();
+        bool destroyed = reader.readFlag();
+        if (!reader.ok() || static_cast<int>(type) >= BLOCK_TYPE_COUNT) return false;
+
+        levelBlocks.emplace_back(position, type);
+        levelBlocks.back().restoreState(health, destroyed);
+    }
+    blockGrid.rebuild(levelBlocks);
+
+    if (!flowField.loadState(reader)) return false;
+    aiScheduler.loadState(reader);
+
+    bool hasPlayer = reader.readFlag();
+    if (!reader.ok()) return false;
+    if (hasPlayer) {
+        if (!player) {
+            player = std::make_unique<PlayerTank>(sf::Vector2f(100, 100), &bullets, &tuning);
+        }
+        float scale = 1.0f + (level - 1) * 0.5f;
+        player->setScale(scale, scale);
+        player->loadState(reader);
+    }
+    else {
+        player.reset();
+    }
+
+    // Existing enemies are reused so stepping back and forth does not reload
+    // their textures; only the missing ones are constructed
+    std::uint32_t enemyCount = reader.read<std::uint32_t>();
+    if (!reader.ok() || enemyCount > reader.remaining() / ENEMY_RECORD_BYTES) return false;
+    if (enemies.size() > enemyCount) {
+        enemies.resize(enemyCount);
+    }
+    while (enemies.size() < enemyCount) {
+        enemies.push_back(std::make_unique<EnemyTank>(sf::Vector2f(0, 0), player.get(), &bullets, &flowField, &tuning));
+    }
+    for (auto& enemy : enemies) {
+        enemy->bind(player.get(), &bullets, &flowField, &tuning);
+        enemy->loadState(reader);
+    }
+
+    if (!bullets.loadState(reader)) return false;
+    return reader.ok() && reader.atEnd();
+}
+
+void World::startPhases() {
+    if (profiling) {
+        phaseMark = std::chrono::steady_clock::now();
+    }
+}
+
+void World::markPhase(WorldPhase phase) {
+    if (!profiling) return;
+
+    auto now = std::chrono::steady_clock::now();
+    phaseSeconds[phase] += std::chrono::duration<double>(now - phaseMark).count();
+    phaseMark = now;
+}
+
+void World::reset(std::uint64_t matchSeed) {
+    seed = matchSeed;
+    random.seed(seed);
+    score = 0;
+    level = 1;
+    enemySpawnInterval = tuning.enemySpawnInterval;
+    stats = MatchStats();
+    setupLevel();
+}
+
+void World::setupLevel() {
+    // The grid and broadphase point into levelBlocks, so destroyed blocks stay
+    // in the vector until the next level instead of being erased
+    levelBlocks.clear();
+    createLevelBlocks();
+    blockGrid.rebuild(levelBlocks);
+    flowField.setObstacles(tilemap);
+
+    player = std::make_unique<PlayerTank>(sf::Vector2f(100, 100), &bullets, &tuning);
+
+    float scale = 1.0f + (level - 1) * 0.5f;
+    player->setScale(scale, scale);
+
+    float enemySpeed = tuning.enemySpeed;
+    if (level >= 5) {
+        enemySpeed += 40.0f;
+    }
+    else if (level >= 3) {
+        enemySpeed += 20.0f;
+    }
+    for (auto& enemy : enemies) {
+        enemy->setSpeed(enemySpeed);
+        if (level >= 5) {
+            enemySpeed += 20.0f;
+            enemy->setAttackCooldown(tuning.enemyAttackCooldown * 0.7f);
+        }
+    }
+
+    enemies.clear();
+    bullets.clear();
+
+    enemiesToDefeat = 5 + (level - 1) * 2;
+    enemiesDefeated = 0;
+
+    enemySpawnTimer = 0.0f;
+    status = WorldStatus::RUNNING;
+}
+
+void World::createLevelBlocks() {
+    // No wall boundaries - open world with sand background
+    tilemap.clear();
+
+    // Scatter keeps the density of the original one-screen map: 20 trees per
+    // screen, plus a short wall for every screen beyond the first
+    float screens = (bounds.width * bounds.height) /
+        static_cast<float>(Constants::WINDOW_WIDTH * Constants::WINDOW_HEIGHT);
+    int trees = std::max(20, static_cast<int>(20 * screens));
+    int walls = std::max(0, static_cast<int>(screens) - 1);
+
+    // Random tiles keep two tiles clear of the map edges
+    std::uint32_t spanX = static_cast<std::uint32_t>(std::max(1, tilemap.getColumns() - 4));
+    std::uint32_t spanY = static_cast<std::uint32_t>(std::max(1, tilemap.getRows() - 4));
+    for (int i = 0; i < trees; ++i) {
+        int x = 2 + static_cast<int>(random.nextInt(spanX));
+        int y = 2 + static_cast<int>(random.nextInt(spanY));
+        tilemap.setTile(x, y, BlockType::DESTRUCTIBLE);
+    }
+    for (int i = 0; i < walls; ++i) {
+        int x = 2 + static_cast<int>(random.nextInt(spanX));
+        int y = 2 + static_cast<int>(random.nextInt(spanY));
+        tilemap.setTile(x, y, BlockType::WALL_INDESTRUCTIBLE);
+        tilemap.setTile(x + 1, y, BlockType::WALL_INDESTRUCTIBLE);
+    }
+    // Some strategic tree blocks for cover
+    tilemap.setTile(7, 6, BlockType::DESTRUCTIBLE);
+    tilemap.setTile(8, 5, BlockType::DESTRUCTIBLE);
+    tilemap.setTile(11, 10, BlockType::DESTRUCTIBLE);
+    tilemap.setTile(10, 11, BlockType::DESTRUCTIBLE);
+
+    // Add some indestructible wall blocks for strategic gameplay
+    tilemap.setTile(5, 5, BlockType::WALL_INDESTRUCTIBLE);
+    tilemap.setTile(6, 5, BlockType::WALL_INDESTRUCTIBLE);
+    tilemap.setTile(15, 10, BlockType::WALL_INDESTRUCTIBLE);
+    tilemap.setTile(16, 10, BlockType::WALL_INDESTRUCTIBLE);
+
+    tilemap.setTile(10, 7, BlockType::WATER);
+    tilemap.setTile(11, 7, BlockType::WATER);
+
+    // Every tile gets a Block for health and collision queries
+    for (int y = 0; y < tilemap.getRows(); ++y) {
+        for (int x = 0; x < tilemap.getColumns(); ++x) {
+            if (tilemap.hasTile(x, y)) {
+                levelBlocks.emplace_back(tilemap.tileCenter(x, y), tilemap.getTile(x, y));
+            }
+        }
+    }
+}
+
+void World::applyInput(const PlayerInput& input) {
+    if (status != WorldStatus::RUNNING || !player || player->isDestroyed()) return;
+    startPhases();
+
+    sf::Vector2f movement = input.getMovement();
+    player->move(movement.x, movement.y);
+
+    sf::Vector2f aim = input.getAim();
+    if (aim.x != 0 || aim.y != 0) {
+        float angle = atan2(aim.y, aim.x) * 180.0f / static_cast<float>(M_PI);
+        player->setRotation(angle);
+    }
+
+    if (input.isPressed(PlayerInput::FIRE) && player->canAttack()) {
+        player->attack(player->getCenter() + aim);
+        stats.shotsFired++;
+    }
+    markPhase(PHASE_INPUT);
+}
+
+void World::update(float deltaTime) {
+    if (status != WorldStatus::RUNNING) return;
+    startPhases();
+
+    if (player) {
+        player->storePreviousPosition();
+    }
+    for (auto& enemy : enemies) {
+        enemy->storePreviousPosition();
+    }
+
+    if (player && !player->isDestroyed()) {
+        stats.timeAlive += deltaTime;
+        player->update(deltaTime);
+        player->updateMovement(deltaTime, blockGrid, bounds);
+    }
+    markPhase(PHASE_PLAYER);
+
+    // One field toward the player serves every enemy this tick
+    bool playerAlive = player && !player->isDestroyed();
+    if (playerAlive) {
+        flowField.setTarget(player->getCenter());
+    }
+    markPhase(PHASE_FLOW_FIELD);
+
+    if (playerAlive) {
+        // The camera keeps the player centred, so a window-sized area around
+        // the player is what is on screen
+        sf::Vector2f screen(static_cast<float>(Constants::WINDOW_WIDTH), static_cast<float>(Constants::WINDOW_HEIGHT));
+        aiScheduler.update(enemies, sf::FloatRect(player->getCenter() - screen / 2.0f, screen));
+    }
+    markPhase(PHASE_AI);
+
+    for (auto& enemy : enemies) {
+        if (enemy && !enemy->isDestroyed()) {
+            enemy->update(deltaTime);
+            enemy->updateMovement(deltaTime, blockGrid, bounds);
+        }
+    }
+    markPhase(PHASE_ENEMIES);
+
+    bullets.update(deltaTime, bounds);
+    markPhase(PHASE_BULLETS);
+
+    spawnEnemies(deltaTime);
+    markPhase(PHASE_SPAWN);
+
+    checkCollisions();
+    markPhase(PHASE_COLLISIONS);
+
+    cleanupObjects();
+    markPhase(PHASE_CLEANUP);
+
+    if (player && player->isDestroyed()) {
+        status = WorldStatus::GAME_OVER;
+    }
+    else if (enemiesDefeated >= enemiesToDefeat) {
+        nextLevel();
+    }
+}
+
+void World::spawnEnemies(float deltaTime) {
+    enemySpawnTimer += deltaTime;
+    if (enemySpawnTimer >= enemySpawnInterval) {
+        if (enemies.size() < 3 && (enemiesDefeated + enemies.size()) < enemiesToDefeat) {
+            sf::Vector2f spawnPos = getRandomSpawnPosition();
+            auto enemy = std::make_unique<EnemyTank>(spawnPos, player.get(), &bullets, &flowField, &tuning);
+            enemies.push_back(std::move(enemy));
+        }
+        enemySpawnTimer = 0.0f;
+    }
+}
+
+sf::Vector2f World::getRandomSpawnPosition() {
+    sf::Vector2f pos;
+    bool validPosition = false;
+    int attempts = 0;
+
+    while (!validPosition && attempts < 100) {
+        pos.x = bounds.left + 50 + static_cast<float>(random.nextInt(static_cast<std::uint32_t>(bounds.width - 100)));
+        pos.y = bounds.top + 50 + static_cast<float>(random.nextInt(static_cast<std::uint32_t>(bounds.height - 100)));
+
+        validPosition = true;
+
+        if (player) {
+            sf::Vector2f playerPos = player->getCenter();
+            float distance = sqrt(pow(pos.x - playerPos.x, 2) + pow(pos.y - playerPos.y, 2));
+            if (distance < 200.0f) {
+                validPosition = false;
+            }
+        }
+
+        sf::FloatRect spawnArea(pos.x - 20, pos.y - 20, 40, 40);
+        if (blockGrid.isAreaBlocked(spawnArea)) {
+            validPosition = false;
+        }
+
+        attempts++;
+    }
+
+    return pos;
+}
+
+void World::checkCollisions() {
+    broadphase.build(bullets, enemies, player.get(), blockGrid);
+
+    for (const auto& pair : broadphase.getBlockPairs()) {
+        Block& block = *pair.block;
+        if (!bullets.isAlive(pair.bullet) || block.isDestroyed()) continue;
+
+        block.takeDamage(bullets.getDamage(pair.bullet));
+        bullets.kill(pair.bullet);
+
+        if (block.isDestroyed()) {
+            score += 5;
+            blockGrid.remove(&block);
+            sf::Vector2i tile = tilemap.tileAt(block.getCenter());
+            tilemap.clearTile(tile.x, tile.y);
+            flowField.openCell(tile.x, tile.y);
+        }
+    }
+
+    for (const auto& pair : broadphase.getTankPairs()) {
+        if (!bullets.isAlive(pair.bullet)) continue;
+
+        if (pair.tank != Broadphase::PLAYER) {
+            EnemyTank& enemy = *enemies[pair.tank];
+            if (enemy.isDestroyed()) continue;
+
+            enemy.takeDamage(bullets.getDamage(pair.bullet));
+            if (bullets.isFromPlayer(pair.bullet)) {
+                stats.shotsHit++;
+            }
+            bullets.kill(pair.bullet);
+
+            if (enemy.isDestroyed()) {
+                score += 100;
+                enemiesDefeated++;
+            }
+        }
+        else {
+            if (player && !player->isDestroyed()) {
+                float healthBefore = player->getHealth();
+                player->takeDamage(bullets.getDamage(pair.bullet));
+                stats.damageTaken += healthBefore - player->getHealth();
+                bullets.kill(pair.bullet);
+                break;
+            }
+        }
+    }
+
+    if (player && !player->isDestroyed()) {
+        for (size_t index : broadphase.getPlayerContacts()) {
+            auto& enemy = enemies[index];
+            if (enemy->isDestroyed()) continue;
+
+            if (player->getBounds().intersects(enemy->getBounds())) {
+                sf::Vector2f separation = player->getCenter() - enemy->getCenter();
+                float distance = sqrt(separation.x * separation.x + separation.y * separation.y);
+                if (distance > 0) {
+                    separation /= distance;
+                    separation *= 2.0f;
+
+                    sf::Vector2f playerPos = BaseTank::clampToArea(player->getCenter() + separation, bounds);
+                    sf::Vector2f enemyPos = BaseTank::clampToArea(enemy->getCenter() - separation, bounds);
+
+                    player->setPosition(playerPos);
+                    enemy->setPosition(enemyPos);
+                }
+            }
+        }
+    }
+}
+
+void World::cleanupObjects() {
+    bullets.removeDead();
+
+    enemies.erase(
+        std::remove_if(enemies.begin(), enemies.end(),
+            [](const std::unique_ptr<EnemyTank>& enemy) {
+                return !enemy || enemy->isDestroyed();
+            }),
+        enemies.end()
+    );
+}
+
+void World::nextLevel() {
+    level++;
+    score += 500;
+
+    if (level > 5) {
+        level--;
+        status = WorldStatus::VICTORY;
+        return;
+    }
+
+    enemySpawnInterval = std::max(1.0f, enemySpawnInterval - 0.2f);
+    status = WorldStatus::LEVEL_CLEARED;
+}
@@ -0,0 +1,142 @@
+#pragma once
+#include "Constants.h"
+#include "PlayerTank.h"
+#include "EnemyTank.h"
+#include "BulletPool.h"
+#include "Block.h"
+#include "BlockGrid.h"
+#include "Tilemap.h"
+#include "Broadphase.h"
+#include "FlowField.h"
+#include "AIScheduler.h"
+#include "Random.h"
+#include "PlayerInput.h"
+#include "Snapshot.h"
+#include "Tuning.h"
+#include <SFML/System.hpp>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <chrono>
+#include <iosfwd>
+
+enum class WorldStatus { RUNNING, LEVEL_CLEARED, GAME_OVER, VICTORY };
+
+// Parts of a tick timed when profiling is enabled
+enum WorldPhase {
+    PHASE_INPUT = 0,
+    PHASE_PLAYER,
+    PHASE_FLOW_FIELD,
+    PHASE_AI,
+    PHASE_ENEMIES,
+    PHASE_BULLETS,
+    PHASE_SPAWN,
+    PHASE_COLLISIONS,
+    PHASE_CLEANUP,
+    PHASE_COUNT
+};
+
+const char* getPhaseName(int phase);
+
+// How the player fared over a match, for balancing
+struct MatchStats {
+    float timeAlive = 0.0f;
+    unsigned shotsFired = 0;
+    // Player shots that hit an enemy
+    unsigned shotsHit = 0;
+    float damageTaken = 0.0f;
+
+    float getAccuracy() const { return shotsFired > 0 ? static_cast<float>(shotsHit) / shotsFired : 0.0f; }
+};
+
+// Simulation state of one match: entities, spawning, collisions and the
+// score/level rules. It owns no window, audio or input and all of its timers
+// run on simulated time, so it can be stepped headless as fast as the CPU allows.
+class World {
+private:
+    std::unique_ptr<PlayerTank> player;
+    std::vector<std::unique_ptr<EnemyTank>> enemies;
+    BulletPool bullets;
+    Tilemap tilemap;
+    std::vector<Block> levelBlocks;
+    BlockGrid blockGrid;
+    Broadphase broadphase;
+    FlowField flowField;
+    AIScheduler aiScheduler;
+    sf::FloatRect bounds;
+    std::uint64_t seed;
+    Random random;
+    Tuning tuning;
+    MatchStats stats;
+
+    WorldStatus status;
+    int score;
+    int level;
+    int enemiesToDefeat;
+    int enemiesDefeated;
+    float enemySpawnTimer;
+    float enemySpawnInterval;
+
+    bool profiling;
+    std::chrono::steady_clock::time_point phaseMark;
+    double phaseSeconds[PHASE_COUNT];
+
+    void createLevelBlocks();
+    void spawnEnemies(float deltaTime);
+    sf::Vector2f getRandomSpawnPosition();
+    void checkCollisions();
+    void cleanupObjects();
+    void nextLevel();
+    void startPhases();
+    // Charges the time since the previous mark to phase
+    void markPhase(WorldPhase phase);
+
+public:
+    World(unsigned width = Constants::WORLD_WIDTH, unsigned height = Constants::WORLD_HEIGHT);
+
+    // Starts a new match; the same seed replays the same level layouts and spawns
+    void reset(std::uint64_t matchSeed);
+    void setupLevel();
+    // Applies one tick of player input; call right before update()
+    void applyInput(const PlayerInput& input);
+    void update(float deltaTime);
+
+    WorldStatus getStatus() const { return status; }
+    int getScore() const { return score; }
+    int getLevel() const { return level; }
+    int getEnemiesRemaining() const { return enemiesToDefeat - enemiesDefeated; }
+    const sf::FloatRect& getBounds() const { return bounds; }
+    std::uint64_t getSeed() const { return seed; }
+    Random& getRandom() { return random; }
+    const MatchStats& getStats() const { return stats; }
+
+    // Safe between ticks. Bullets, AI, spawning and tank speeds and cooldowns
+    // follow at once; health applies to tanks created afterwards.
+    void setTuning(const Tuning& values);
+    const Tuning& getTuning() const { return tuning; }
+
+    PlayerTank* getPlayer() { return player.get(); }
+    const PlayerTank* getPlayer() const { return player.get(); }
+    const std::vector<std::unique_ptr<EnemyTank>>& getEnemies() const { return enemies; }
+    const BulletPool& getBullets() const { return bullets; }
+    const std::vector<Block>& getBlocks() const { return levelBlocks; }
+    const Tilemap& getTilemap() const { return tilemap; }
+    const BlockGrid& getBlockGrid() const { return blockGrid; }
+    const FlowField& getFlowField() const { return flowField; }
+    const AIScheduler& getAIScheduler() const { return aiScheduler; }
+
+    // Serializes the whole simulation state into out (replacing its contents).
+    // Entities refer to each other only through World ownership and pool
+    // indices, so the snapshot holds no pointers and restoring rebinds them.
+    void saveSnapshot(std::vector<std::uint8_t>& out) const;
+    // Loads a snapshot saved by a World of the same size. On false the world
+    // is left half-restored and must be reset() before it is stepped again.
+    bool restoreSnapshot(const std::vector<std::uint8_t>& data);
+
+    // Accumulates wall time per WorldPhase; off by default and nearly free when off
+    void setProfiling(bool enabled);
+    void resetProfile();
+    double getPhaseSeconds(int phase) const { return phaseSeconds[phase]; }
+    // One line per phase: total time, time per tick and share of the tick
+    void writeProfile(std::ostream& out, long ticks) const;
+};
@@ -0,0 +1,36 @@
+#include "WorldSandbox.h"
+
+WorldSandbox::WorldSandbox(unsigned width, unsigned height)
+    : world(width, height), branched(false) {
+}
+
+bool WorldSandbox::branchFrom(const World& source) {
+    source.saveSnapshot(branchPoint);
+    branched = world.restoreSnapshot(branchPoint);
+    return branched;
+}
+
+bool WorldSandbox::rewind() {
+    if (!branched) return false;
+
+    // The branch point restored once already, so this only fails on a bug
+    branched = world.restoreSnapshot(branchPoint);
+    return branched;
+}
+
+bool WorldSandbox::step(const PlayerInput& input, float deltaTime) {
+    if (!branched || world.getStatus() != WorldStatus::RUNNING) return false;
+
+    world.applyInput(input);
+    world.update(deltaTime);
+    return world.getStatus() == WorldStatus::RUNNING;
+}
+
+int WorldSandbox::run(InputSource& input, int ticks, float deltaTime) {
+    int tick = 0;
+    while (branched && tick < ticks && world.getStatus() == WorldStatus::RUNNING && !input.isFinished()) {
+        step(input.nextInput(world), deltaTime);
+        tick++;
+    }
+    return tick;
+}
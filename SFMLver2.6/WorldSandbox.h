@@ -0,0 +1,40 @@
+#pragma once
+#include "World.h"
+#include "PlayerInput.h"
+#include <vector>
+#include <cstdint>
+
+// Scratch copy of a World for trying moves against the real simulation
+// rules. branchFrom() copies a live world in, the sandbox is stepped forward
+// in isolation and rewind() puts it back to the branch point for the next
+// candidate. World itself has no audio, rendering or file I/O, so nothing a
+// rollout does leaks out of the sandbox.
+//
+// The sandbox keeps its world, enemy objects, block and bullet storage and
+// snapshot buffer between branches, so once warmed up a branch or rewind
+// does not allocate per entity.
+class WorldSandbox {
+private:
+    World world;
+    std::vector<std::uint8_t> branchPoint;
+    bool branched;
+
+public:
+    WorldSandbox(unsigned width = Constants::WORLD_WIDTH, unsigned height = Constants::WORLD_HEIGHT);
+
+    // Copies source in and makes it the branch point. False when source has
+    // a different size; the sandbox is then unbranched.
+    bool branchFrom(const World& source);
+    // Back to the state of the last branchFrom()
+    bool rewind();
+    bool isBranched() const { return branched; }
+
+    // Steps one tick; false once the match left RUNNING (level cleared, lost or won)
+    bool step(const PlayerInput& input, float deltaTime);
+    // Steps up to ticks ticks, stopping early when the match leaves RUNNING.
+    // Returns the number of ticks simulated.
+    int run(InputSource& input, int ticks, float deltaTime);
+
+    World& getWorld() { return world; }
+    const World& getWorld() const { return world; }
+};
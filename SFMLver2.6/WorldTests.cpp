@@ -0,0 +1,220 @@
+// Console checks for the simulation code that runs without a window. Each
+// test prints FAIL lines for broken expectations; the exit code is the number
+// of failed checks.
+#include "World.h"
+#include "AIScheduler.h"
+#include "Tilemap.h"
+#include "Snapshot.h"
+#include "Random.h"
+#include "ResourceManager.h"
+#include "BulletIntegrator.h"
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace {
+    int failures = 0;
+
+    void check(bool condition, const char* test, const char* expectation) {
+        if (!condition) {
+            std::cerr << "FAIL " << test << ": " << expectation << "\n";
+            failures++;
+        }
+    }
+
+    void stepWorld(World& world, long ticks) {
+        for (long tick = 0; tick < ticks && world.getStatus() != WorldStatus::GAME_OVER; ++tick) {
+            world.update(1.0f / Constants::TICK_RATE);
+            if (world.getStatus() == WorldStatus::LEVEL_CLEARED) {
+                world.setupLevel();
+            }
+        }
+    }
+
+    void testFlagRejectsNonBooleanBytes() {
+        std::vector<std::uint8_t> data = { 0, 1, 195 };
+        SnapshotReader reader(data.data(), data.size());
+        check(!reader.readFlag(), "flags", "0 reads as false");
+        check(reader.readFlag(), "flags", "1 reads as true");
+        reader.readFlag();
+        check(!reader.ok(), "flags", "195 fails the reader");
+    }
+
+    void testTilemapRejectsUnknownTileTypes() {
+        Tilemap source(Constants::BLOCK_SIZE * 2, Constants::BLOCK_SIZE);
+        std::vector<std::uint8_t> data;
+        SnapshotWriter writer(data);
+        source.saveState(writer);
+        data.back() = static_cast<std::uint8_t>(BLOCK_TYPE_COUNT + 1);
+
+        Tilemap target(Constants::BLOCK_SIZE * 2, Constants::BLOCK_SIZE);
+        SnapshotReader reader(data.data(), data.size());
+        check(!target.loadState(reader), "tilemap", "a tile byte past the last block type is rejected");
+    }
+
+    // The scalar and SIMD kernels must agree lane for lane, NaN positions
+    // included. Nine bullets cover a full AVX block plus the scalar tail.
+    void testKernelsAgreeOnCulling() {
+        const float nan = std::numeric_limits<float>::quiet_NaN();
+        const float startX[] = { 10, nan, 10, -5, 10, 10, 110, nan, 50 };
+        const float startY[] = { 10, 10, nan, 10, 10, 10, 10, 50, nan };
+        const std::size_t count = sizeof(startX) / sizeof(startX[0]);
+        const BulletIntegrator::Bounds bounds = { 0, 0, 100, 100 };
+
+        std::vector<std::uint8_t> results[2];
+        for (int simd = 0; simd < 2; ++simd) {
+            std::vector<float> x(startX, startX + count), y(startY, startY + count);
+            std::vector<float> previousX(count), previousY(count), velocity(count, 1.0f);
+            results[simd].assign(count, 1);
+            BulletIntegrator::Arrays arrays = { x.data(), y.data(), previousX.data(), previousY.data(),
+                velocity.data(), velocity.data(), results[simd].data(), count };
+            BulletIntegrator::select(simd == 1);
+            BulletIntegrator::integrate(arrays, 1.0f, bounds);
+        }
+        BulletIntegrator::select();
+
+        check(results[0] == results[1], "bullets", "scalar and SIMD kernels cull the same bullets");
+        check(!results[0][1] && !results[0][2] && !results[0][7] && !results[0][8], "bullets",
+            "bullets at a NaN position are culled");
+        check(results[0][0] && !results[0][3] && !results[0][6], "bullets", "finite positions cull by bounds");
+    }
+
+    // Corrupted snapshots must be turned down or restored, never crash, and a
+    // rejected restore must leave a world that reset() brings back
+    void testCorruptSnapshots() {
+        World world;
+        world.reset(7);
+        stepWorld(world, 20L * Constants::TICK_RATE);
+
+        std::vector<std::uint8_t> snapshot;
+        world.saveSnapshot(snapshot);
+        World target;
+        target.reset(1);
+        check(target.restoreSnapshot(snapshot), "snapshot", "an intact snapshot restores");
+
+        std::vector<std::uint8_t> truncated(snapshot.begin(), snapshot.end() - 1);
+        check(!target.restoreSnapshot(truncated), "snapshot", "a truncated snapshot is rejected");
+
+        Random random(12345);
+        int rejected = 0;
+        for (int run = 0; run < 200; ++run) {
+            std::vector<std::uint8_t> corrupt = snapshot;
+            unsigned flips = 1 + random.nextInt(16);
+            for (unsigned i = 0; i < flips; ++i) {
+                // Past the magic and version, which are rejected trivially
+                std::uint32_t offset = 8 + random.nextInt(static_cast<std::uint32_t>(corrupt.size() - 8));
+                corrupt[offset] = static_cast<std::uint8_t>(random.next());
+            }
+
+            if (!target.restoreSnapshot(corrupt)) {
+                rejected++;
+                target.reset(1);
+            }
+            stepWorld(target, 10);
+        }
+        check(rejected > 0, "snapshot", "some corrupted snapshots are rejected");
+    }
+
+    // Overwrites the count written just before the first record that starts
+    // with the given bytes; false when the record is not found
+    bool corruptCount(std::vector<std::uint8_t>& snapshot, std::uint32_t count,
+        const std::vector<std::uint8_t>& firstRecord, std::uint32_t value) {
+        std::vector<std::uint8_t> needle;
+        SnapshotWriter writer(needle);
+        writer.write(count);
+        needle.insert(needle.end(), firstRecord.begin(), firstRecord.end());
+
+        auto found = std::search(snapshot.begin(), snapshot.end(), needle.begin(), needle.end());
+        if (found == snapshot.end()) return false;
+        std::vector<std::uint8_t> bytes;
+        SnapshotWriter(bytes).write(value);
+        std::copy(bytes.begin(), bytes.end(), found);
+        return true;
+    }
+
+    // A huge block or enemy count must be turned down before anything is
+    // reserved or constructed for it, not by running out of memory
+    void testHugeCountsAreRejected() {
+        World world;
+        world.reset(7);
+        stepWorld(world, 20L * Constants::TICK_RATE);
+        std::vector<std::uint8_t> snapshot;
+        world.saveSnapshot(snapshot);
+
+        World target;
+        target.reset(1);
+        std::vector<std::uint8_t> firstBlock;
+        SnapshotWriter(firstBlock).write(world.getBlocks().front().getCenter());
+        std::vector<std::uint8_t> corrupt = snapshot;
+        bool found = corruptCount(corrupt, static_cast<std::uint32_t>(world.getBlocks().size()), firstBlock, 0xFFFFFFF0u);
+        check(found, "snapshot", "the block count field is found");
+        check(found && !target.restoreSnapshot(corrupt), "snapshot", "a huge block count is rejected");
+
+        if (world.getEnemies().empty()) return;
+        std::vector<std::uint8_t> firstEnemy;
+        SnapshotWriter(firstEnemy).write(world.getEnemies().front()->getCenter());
+        corrupt = snapshot;
+        found = corruptCount(corrupt, static_cast<std::uint32_t>(world.getEnemies().size()), firstEnemy, 100000u);
+        check(found, "snapshot", "the enemy count field is found");
+        check(found && !target.restoreSnapshot(corrupt), "snapshot", "a huge enemy count is rejected");
+        check(target.restoreSnapshot(snapshot), "snapshot", "the intact snapshot still restores afterwards");
+    }
+
+    // More enemies on screen than buckets * budget can serve: every enemy
+    // must still think at least once every count / budget ticks (rounded up,
+    // plus one for the tick a cut lands on) instead of missing whole rounds
+    void testSchedulerServesDeferredEnemies() {
+        const unsigned buckets = 4;
+        const unsigned budget = 16;
+        const size_t count = buckets * budget * 2 + 7;
+
+        Tuning tuning;
+        BulletPool bullets;
+        PlayerTank player(sf::Vector2f(800, 600), &bullets, &tuning);
+        std::vector<std::unique_ptr<EnemyTank>> enemies;
+        for (size_t i = 0; i < count; ++i) {
+            sf::Vector2f position(100.0f + (i % 30) * 45.0f, 100.0f + (i / 30) * 45.0f);
+            enemies.push_back(std::make_unique<EnemyTank>(position, &player, &bullets, nullptr, &tuning));
+        }
+
+        AIScheduler scheduler(buckets, 4, budget);
+        sf::FloatRect everywhere(0, 0, 2000, 2000);
+        // A full-tier think turns the tank toward the player, so a rotation no
+        // heading can have shows which enemies did not think this tick
+        const float UNTOUCHED = 1000.0f;
+        std::vector<long> waiting(count, 0);
+        long longestWait = 0;
+        for (int tick = 0; tick < 400; ++tick) {
+            for (auto& enemy : enemies) {
+                enemy->setRotation(UNTOUCHED);
+            }
+            scheduler.update(enemies, everywhere);
+            for (size_t i = 0; i < count; ++i) {
+                waiting[i] = enemies[i]->getRotation() == UNTOUCHED ? waiting[i] + 1 : 0;
+                longestWait = std::max(longestWait, waiting[i]);
+            }
+        }
+
+        long bound = static_cast<long>((count + budget - 1) / budget) + 1;
+        check(longestWait <= bound, "scheduler", "no enemy waits longer than count / budget ticks to think");
+        unsigned long thinks = scheduler.getStats().fullThinks;
+        check(thinks == 400ul * budget, "scheduler", "an overloaded scheduler spends its whole budget every tick");
+    }
+}
+
+int main() {
+    ResourceManager::instance().setLoadingEnabled(false);
+
+    testFlagRejectsNonBooleanBytes();
+    testTilemapRejectsUnknownTileTypes();
+    testKernelsAgreeOnCulling();
+    testCorruptSnapshots();
+    testHugeCountsAreRejected();
+    testSchedulerServesDeferredEnemies();
+
+    std::cout << (failures == 0 ? "All checks passed\n" : "Some checks failed\n");
+    return failures;
+}